@@ -0,0 +1,330 @@
+#include "audio_archive.h"
+#include <algorithm>
+#include <math.h>
+#include <string.h>
+
+static const int FRAME_RATE = AUDIO_ARCHIVE_SAMPLE_RATE / AUDIO_ARCHIVE_HOP_LENGTH;
+static const int CHUNK_SAMPLES = AUDIO_ARCHIVE_CHUNK_SECONDS * AUDIO_ARCHIVE_SAMPLE_RATE;
+
+// Chunks waiting for the encoder before the oldest is dropped, the archive then has a gap
+static const size_t MAX_QUEUED_CHUNKS = 12;
+
+// Codebooks Encodec uses at a bandwidth
+static int num_codebooks(float kbps) {
+    return std::max(1, (int) floorf(kbps * 1000 / (AUDIO_ARCHIVE_CODE_BITS * FRAME_RATE)));
+}
+
+static size_t packed_bytes(int n_codes) {
+    return ((size_t) n_codes * AUDIO_ARCHIVE_CODE_BITS + 7) / 8;
+}
+
+static void pack_codes(const int32_t* codes, int n_codes, uint8_t* out) {
+    uint32_t bits = 0;
+    int n_bits = 0;
+    for (int i = 0; i < n_codes; i++) {
+        bits |= (uint32_t) codes[i] << n_bits;
+        n_bits += AUDIO_ARCHIVE_CODE_BITS;
+        while (n_bits >= 8) {
+            *out++ = bits & 0xff;
+            bits >>= 8;
+            n_bits -= 8;
+        }
+    }
+    if (n_bits > 0) *out = bits & 0xff;
+}
+
+static void unpack_codes(const uint8_t* data, int n_codes, int32_t* codes) {
+    uint32_t bits = 0;
+    int n_bits = 0;
+    for (int i = 0; i < n_codes; i++) {
+        while (n_bits < AUDIO_ARCHIVE_CODE_BITS) {
+            bits |= (uint32_t) *data++ << n_bits;
+            n_bits += 8;
+        }
+        codes[i] = bits & ((1u << AUDIO_ARCHIVE_CODE_BITS) - 1);
+        bits >>= AUDIO_ARCHIVE_CODE_BITS;
+        n_bits -= AUDIO_ARCHIVE_CODE_BITS;
+    }
+}
+
+// Encode a chunk and append it to the file, on the encoding thread. The encoder continues from
+// the previous chunk unless chunks were dropped in between, so the audio has no seams.
+static bool encode_chunk(AudioArchiveWriter* archive, int64_t t_start, std::vector<float>& audio) {
+    const bool continues = t_start == archive->n_encoded;
+    if (!continues) encodec_reset_stream(archive->ectx);
+
+    // Pad to whole frames, the chunks before the last are whole frames already
+    const int n_samples = audio.size();
+    const int n_frames = (n_samples + AUDIO_ARCHIVE_HOP_LENGTH - 1) / AUDIO_ARCHIVE_HOP_LENGTH;
+    audio.resize(n_frames * AUDIO_ARCHIVE_HOP_LENGTH, 0.0f);
+    archive->n_encoded = t_start + n_samples;
+    if (!encodec_compress_audio_stream(archive->ectx, audio.data(), audio.size(), archive->n_threads)) {
+        fprintf(stderr, "%s: Could not encode audio\n", __func__);
+        return false;
+    }
+    const int32_t* codes = encodec_get_codes(archive->ectx);
+    const int n_codes = encodec_get_codes_size(archive->ectx);
+    if (n_codes != n_frames * (int) archive->header.n_q) {
+        fprintf(stderr, "%s: Got %d codes for %d frames\n", __func__, n_codes, n_frames);
+        return false;
+    }
+
+    std::vector<uint8_t> packed(packed_bytes(n_codes));
+    pack_codes(codes, n_codes, packed.data());
+
+    // Flushed so a crash loses at most the chunks being encoded
+    AudioArchiveChunk chunk = { AUDIO_ARCHIVE_CHUNK_MAGIC, (uint32_t) n_frames, (uint32_t) n_samples, continues ? AUDIO_ARCHIVE_CHUNK_CONTINUES : 0u, t_start };
+    const int64_t offset = ftell(archive->file);
+    bool ok = fwrite(&chunk, sizeof(chunk), 1, archive->file) == 1 && fwrite(packed.data(), 1, packed.size(), archive->file) == packed.size();
+    ok = fflush(archive->file) == 0 && ok;
+    if (!ok) {
+        fprintf(stderr, "%s: Could not write chunk\n", __func__);
+        return false;
+    }
+    archive->index.push_back({ offset, t_start, (uint32_t) n_samples, (uint32_t) n_frames });
+    return true;
+}
+
+static void encode_chunks(AudioArchiveWriter* archive) {
+    std::unique_lock<std::mutex> lock(archive->mutex);
+    while (true) {
+        archive->cond.wait(lock, [archive] { return !archive->queue.empty() || archive->closing; });
+        if (archive->queue.empty()) return;
+        std::pair<int64_t, std::vector<float>> chunk = std::move(archive->queue.front());
+        archive->queue.pop_front();
+        lock.unlock();
+        const bool ok = encode_chunk(archive, chunk.first, chunk.second);
+        lock.lock();
+        if (!ok) archive->failed = true;
+    }
+}
+
+// Hand the pending audio to the encoding thread
+static void queue_chunk(AudioArchiveWriter* archive, int n_samples) {
+    std::vector<float> audio(archive->pending.begin(), archive->pending.begin() + n_samples);
+    archive->pending.erase(archive->pending.begin(), archive->pending.begin() + n_samples);
+    {
+        std::lock_guard<std::mutex> lock(archive->mutex);
+        if (archive->queue.size() >= MAX_QUEUED_CHUNKS) {
+            fprintf(stderr, "%s: Cannot encode audio fast enough, dropping %d s\n", __func__, AUDIO_ARCHIVE_CHUNK_SECONDS);
+            archive->queue.pop_front();
+        }
+        archive->queue.emplace_back(archive->n_queued, std::move(audio));
+    }
+    archive->n_queued += n_samples;
+    archive->cond.notify_one();
+}
+
+bool open_audio_archive(AudioArchiveWriter* archive, const char* path, struct encodec_context* ectx, float bandwidth_kbps, int input_rate, int n_threads) {
+    // Encodec takes whole kbps, which must select the same codebooks
+    const int n_q = num_codebooks(bandwidth_kbps);
+    const int bandwidth = (int) ceilf(bandwidth_kbps);
+    if (num_codebooks(bandwidth) != n_q) {
+        fprintf(stderr, "%s: Encodec cannot encode %.2f kbps, use 1.5, 3 or 6 kbps\n", __func__, bandwidth_kbps);
+        return false;
+    }
+    encodec_set_target_bandwidth(ectx, bandwidth);
+    encodec_set_sample_rate(ectx, AUDIO_ARCHIVE_SAMPLE_RATE);
+
+    archive->file = fopen(path, "wb");
+    if (!archive->file) {
+        fprintf(stderr, "%s: Could not create %s\n", __func__, path);
+        return false;
+    }
+    archive->header = { AUDIO_ARCHIVE_MAGIC, AUDIO_ARCHIVE_VERSION, AUDIO_ARCHIVE_SAMPLE_RATE, (uint32_t) bandwidth, (uint32_t) n_q, 0 };
+    if (fwrite(&archive->header, sizeof(archive->header), 1, archive->file) != 1) {
+        fprintf(stderr, "%s: Could not write %s\n", __func__, path);
+        fclose(archive->file);
+        archive->file = NULL;
+        return false;
+    }
+
+    archive->ectx = ectx;
+    archive->n_threads = n_threads;
+    archive->input_rate = input_rate;
+    archive->resample_pos = 0.0;
+    archive->last_sample = 0.0f;
+    archive->pending.clear();
+    archive->n_queued = 0;
+    archive->n_encoded = -1;
+    archive->index.clear();
+    archive->queue.clear();
+    archive->closing = false;
+    archive->failed = false;
+    archive->worker = std::thread(encode_chunks, archive);
+    return true;
+}
+
+bool write_audio_archive(AudioArchiveWriter* archive, const float* samples, int n_samples) {
+    if (!archive->file || n_samples <= 0) return archive->file != NULL;
+
+    // Resample to the Encodec rate, interpolating across blocks
+    if (archive->input_rate == AUDIO_ARCHIVE_SAMPLE_RATE) {
+        archive->pending.insert(archive->pending.end(), samples, samples + n_samples);
+    } else {
+        const double step = (double) archive->input_rate / AUDIO_ARCHIVE_SAMPLE_RATE;
+        double pos = archive->resample_pos;
+        while (pos < n_samples - 1) {
+            const int i = (int) floor(pos);
+            const float x0 = i < 0 ? archive->last_sample : samples[i];
+            const float x1 = samples[i + 1];
+            archive->pending.push_back(x0 + (x1 - x0) * (float) (pos - i));
+            pos += step;
+        }
+        archive->resample_pos = pos - n_samples;
+        archive->last_sample = samples[n_samples - 1];
+    }
+
+    while (archive->pending.size() >= (size_t) CHUNK_SAMPLES) queue_chunk(archive, CHUNK_SAMPLES);
+
+    std::lock_guard<std::mutex> lock(archive->mutex);
+    return !archive->failed;
+}
+
+bool close_audio_archive(AudioArchiveWriter* archive) {
+    if (!archive->file) return false;
+
+    // Encode the rest
+    if (!archive->pending.empty()) queue_chunk(archive, archive->pending.size());
+    {
+        std::lock_guard<std::mutex> lock(archive->mutex);
+        archive->closing = true;
+    }
+    archive->cond.notify_one();
+    archive->worker.join();
+
+    // Index
+    AudioArchiveFooter footer = { AUDIO_ARCHIVE_INDEX_MAGIC, (uint32_t) archive->index.size(), (int64_t) ftell(archive->file) };
+    bool ok = !archive->failed;
+    ok = fwrite(archive->index.data(), sizeof(AudioArchiveIndexEntry), archive->index.size(), archive->file) == archive->index.size() && ok;
+    ok = fwrite(&footer, sizeof(footer), 1, archive->file) == 1 && ok;
+    ok = fclose(archive->file) == 0 && ok;
+    archive->file = NULL;
+    if (!ok) fprintf(stderr, "%s: Could not write archive\n", __func__);
+    return ok;
+}
+
+// Find the chunks of an archive that was not closed
+static void walk_chunks(AudioArchiveReader* archive, int64_t file_size) {
+    int64_t offset = sizeof(AudioArchiveHeader);
+    AudioArchiveChunk chunk;
+    while (fseek(archive->file, offset, SEEK_SET) == 0 && fread(&chunk, sizeof(chunk), 1, archive->file) == 1) {
+        if (chunk.magic != AUDIO_ARCHIVE_CHUNK_MAGIC || chunk.n_frames * AUDIO_ARCHIVE_HOP_LENGTH > CHUNK_SAMPLES + AUDIO_ARCHIVE_HOP_LENGTH) break;
+        const int64_t end = offset + sizeof(chunk) + packed_bytes(chunk.n_frames * archive->header.n_q);
+        if (end > file_size) break;
+        archive->index.push_back({ offset, chunk.t_start, chunk.n_samples, chunk.n_frames });
+        offset = end;
+    }
+}
+
+bool open_audio_archive_reader(AudioArchiveReader* archive, const char* path) {
+    archive->index.clear();
+    archive->file = fopen(path, "rb");
+    if (!archive->file) {
+        fprintf(stderr, "%s: Could not open %s\n", __func__, path);
+        return false;
+    }
+
+    // Check header
+    AudioArchiveHeader& header = archive->header;
+    if (fread(&header, sizeof(header), 1, archive->file) != 1 || header.magic != AUDIO_ARCHIVE_MAGIC || header.version != AUDIO_ARCHIVE_VERSION ||
+        header.sample_rate != AUDIO_ARCHIVE_SAMPLE_RATE || header.n_q == 0 || num_codebooks(header.bandwidth) != (int) header.n_q) {
+        fprintf(stderr, "%s: %s is not an audio archive\n", __func__, path);
+        close_audio_archive_reader(archive);
+        return false;
+    }
+
+    // Read the index, or rebuild it
+    fseek(archive->file, 0, SEEK_END);
+    const int64_t file_size = ftell(archive->file);
+    AudioArchiveFooter footer;
+    bool indexed = file_size >= (int64_t) (sizeof(header) + sizeof(footer)) && fseek(archive->file, file_size - sizeof(footer), SEEK_SET) == 0 &&
+                   fread(&footer, sizeof(footer), 1, archive->file) == 1 && footer.magic == AUDIO_ARCHIVE_INDEX_MAGIC &&
+                   footer.index_offset + (int64_t) (footer.n_chunks * sizeof(AudioArchiveIndexEntry) + sizeof(footer)) == file_size;
+    if (indexed) {
+        archive->index.resize(footer.n_chunks);
+        indexed = fseek(archive->file, footer.index_offset, SEEK_SET) == 0 &&
+                  fread(archive->index.data(), sizeof(AudioArchiveIndexEntry), footer.n_chunks, archive->file) == footer.n_chunks;
+    }
+    if (!indexed) {
+        archive->index.clear();
+        walk_chunks(archive, file_size);
+    }
+    return true;
+}
+
+double audio_archive_duration(const AudioArchiveReader* archive) {
+    if (archive->index.empty()) return 0.0;
+    const AudioArchiveIndexEntry& last = archive->index.back();
+    return (double) (last.t_start + last.n_samples) / archive->header.sample_rate;
+}
+
+bool read_audio_archive(AudioArchiveReader* archive, struct encodec_context* ectx, double t0, double t1, std::vector<float>* audio, int n_threads) {
+    // Samples of the range, gaps in the archive are silent
+    const int64_t end = (int64_t) llround(audio_archive_duration(archive) * archive->header.sample_rate);
+    const int64_t s0 = std::max<int64_t>(0, llround(t0 * archive->header.sample_rate));
+    const int64_t s1 = std::min<int64_t>(end, llround(t1 * archive->header.sample_rate));
+    audio->assign(std::max<int64_t>(0, s1 - s0), 0.0f);
+    if (s1 <= s0) return true;
+
+    encodec_set_target_bandwidth(ectx, archive->header.bandwidth);
+    encodec_set_sample_rate(ectx, archive->header.sample_rate);
+
+    // First chunk ending after the start of the range, the chunk before is decoded too so that the
+    // decoder has the state of the audio before the range when the chunks continue each other
+    auto it = std::lower_bound(archive->index.begin(), archive->index.end(), s0,
+                               [](const AudioArchiveIndexEntry& e, int64_t s) { return e.t_start + e.n_samples <= s; });
+    if (it != archive->index.begin()) --it;
+
+    std::vector<uint8_t> packed;
+    std::vector<int32_t> codes;
+    int64_t t_decoded = 0; // Position of the next sample the decoder outputs
+    bool first = true;
+    for (; it != archive->index.end() && it->t_start < s1; ++it) {
+        // Read the chunk
+        const int n_codes = it->n_frames * archive->header.n_q;
+        AudioArchiveChunk chunk;
+        packed.resize(packed_bytes(n_codes));
+        codes.resize(n_codes);
+        if (fseek(archive->file, it->offset, SEEK_SET) != 0 || fread(&chunk, sizeof(chunk), 1, archive->file) != 1 ||
+            chunk.magic != AUDIO_ARCHIVE_CHUNK_MAGIC || fread(packed.data(), 1, packed.size(), archive->file) != packed.size()) {
+            fprintf(stderr, "%s: Could not read chunk at %lld\n", __func__, (long long) it->offset);
+            return false;
+        }
+        unpack_codes(packed.data(), n_codes, codes.data());
+
+        // Decode, continuing the stream of the decoder when the encoder continued too
+        if (first || !(chunk.flags & AUDIO_ARCHIVE_CHUNK_CONTINUES)) {
+            encodec_reset_stream(ectx);
+            t_decoded = it->t_start;
+        }
+        first = false;
+        if (!encodec_decompress_audio_stream(ectx, codes.data(), n_codes, n_threads)) {
+            fprintf(stderr, "%s: Could not decode chunk at %lld\n", __func__, (long long) it->offset);
+            return false;
+        }
+        // A stream holds back a first chunk shorter than the kernels of Encodec, decode it on its own
+        if (encodec_get_audio_size(ectx) == 0) {
+            encodec_reset_stream(ectx);
+            if (!encodec_decompress_audio(ectx, codes.data(), n_codes, n_threads)) {
+                fprintf(stderr, "%s: Could not decode chunk at %lld\n", __func__, (long long) it->offset);
+                return false;
+            }
+        }
+
+        // Copy the part in the range, up to the padding of the chunk
+        const float* decoded = encodec_get_audio(ectx);
+        const int64_t n_decoded = encodec_get_audio_size(ectx);
+        const int64_t c0 = std::max(s0, t_decoded);
+        const int64_t c1 = std::min(s1, std::min(t_decoded + n_decoded, it->t_start + (int64_t) it->n_samples));
+        if (c1 > c0) memcpy(audio->data() + (c0 - s0), decoded + (c0 - t_decoded), (c1 - c0) * sizeof(float));
+        t_decoded += n_decoded;
+    }
+    return true;
+}
+
+void close_audio_archive_reader(AudioArchiveReader* archive) {
+    if (archive->file) fclose(archive->file);
+    archive->file = NULL;
+    archive->index.clear();
+}
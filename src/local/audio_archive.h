@@ -0,0 +1,102 @@
+// Archive of captured audio compressed with Encodec, so weeks of conversation fit on the SD card.
+
+#include "encodec.h"
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <stdint.h>
+#include <stdio.h>
+#include <string>
+#include <thread>
+#include <vector>
+
+// The 24 kHz Encodec model: 75 frames per second, codebooks of 1024 codes
+#define AUDIO_ARCHIVE_SAMPLE_RATE 24000
+#define AUDIO_ARCHIVE_HOP_LENGTH 320
+#define AUDIO_ARCHIVE_CODE_BITS 10
+
+// Audio encoded at once, also the granularity of seeking
+#define AUDIO_ARCHIVE_CHUNK_SECONDS 5
+
+// File: header, chunks as they are encoded, then the index of the chunks and a footer.
+// An archive that was not closed has no index, the reader finds its chunks by walking them.
+#define AUDIO_ARCHIVE_MAGIC 0x7a636e65 // "encz"
+#define AUDIO_ARCHIVE_CHUNK_MAGIC 0x6b6e6863 // "chnk"
+#define AUDIO_ARCHIVE_INDEX_MAGIC 0x78646e69 // "indx"
+#define AUDIO_ARCHIVE_VERSION 1
+
+typedef struct {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t sample_rate;
+    uint32_t bandwidth;   // Encodec target bandwidth in kbps, selects the codebooks to decode
+    uint32_t n_q;         // Codebooks per frame
+    uint32_t reserved;
+} AudioArchiveHeader;
+
+// The encoder continued from the state of the previous chunk, which then must be decoded first
+#define AUDIO_ARCHIVE_CHUNK_CONTINUES 1
+
+// Chunk header, followed by the codes packed in AUDIO_ARCHIVE_CODE_BITS, codebook by codebook
+typedef struct {
+    uint32_t magic;
+    uint32_t n_frames;
+    uint32_t n_samples;   // Samples of the chunk, the last frame is padded
+    uint32_t flags;       // AUDIO_ARCHIVE_CHUNK_CONTINUES, 0 in the archives of independent chunks
+    int64_t t_start;      // Position of the first sample in the archive
+} AudioArchiveChunk;
+
+typedef struct {
+    int64_t offset;       // Position of the chunk header in the file
+    int64_t t_start;
+    uint32_t n_samples;
+    uint32_t n_frames;
+} AudioArchiveIndexEntry;
+
+typedef struct {
+    uint32_t magic;
+    uint32_t n_chunks;
+    int64_t index_offset;
+} AudioArchiveFooter;
+
+// Writes an archive while recording, chunks are encoded on a thread of their own
+typedef struct {
+    FILE* file;
+    struct encodec_context* ectx; // Used by the encoding thread until the archive is closed
+    int n_threads;
+    AudioArchiveHeader header;
+
+    // Resampling from the capture rate
+    int input_rate;
+    double resample_pos;  // Position of the next output sample, in input samples of the next block
+    float last_sample;    // Last input sample of the previous block
+
+    std::vector<float> pending; // Audio not in a chunk yet
+    int64_t n_queued;           // Samples in chunks, encoded or not
+    int64_t n_encoded;          // End of the last chunk encoded, the next continues the stream of the encoder if it starts there
+    std::vector<AudioArchiveIndexEntry> index;
+
+    // Encoding thread
+    std::thread worker;
+    std::mutex mutex;
+    std::condition_variable cond;
+    std::deque<std::pair<int64_t, std::vector<float>>> queue;
+    bool closing;
+    bool failed;
+} AudioArchiveWriter;
+
+// Reads the chunks of an archive
+typedef struct {
+    FILE* file;
+    AudioArchiveHeader header;
+    std::vector<AudioArchiveIndexEntry> index;
+} AudioArchiveReader;
+
+bool open_audio_archive(AudioArchiveWriter* archive, const char* path, struct encodec_context* ectx, float bandwidth_kbps, int input_rate, int n_threads);
+bool write_audio_archive(AudioArchiveWriter* archive, const float* samples, int n_samples);
+bool close_audio_archive(AudioArchiveWriter* archive);
+
+bool open_audio_archive_reader(AudioArchiveReader* archive, const char* path);
+double audio_archive_duration(const AudioArchiveReader* archive);
+bool read_audio_archive(AudioArchiveReader* archive, struct encodec_context* ectx, double t0, double t1, std::vector<float>* audio, int n_threads);
+void close_audio_archive_reader(AudioArchiveReader* archive);
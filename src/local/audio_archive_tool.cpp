@@ -0,0 +1,126 @@
+// Round trip of the audio archive: records a WAV file, or a synthetic voice, into an Encodec
+// archive in blocks as stream.cpp does while capturing, reads it back whole and from the middle,
+// and compares the audio with the input.
+//
+// Usage: audio-archive encodec.bin offset archive.encz [input.wav] [output.wav]
+
+#include "audio_archive.h"
+#include "common2.h"
+#include "dr_wav.h"
+#include <math.h>
+#include <stdlib.h>
+
+// Capture blocks and bandwidth of stream.cpp
+static const double BLOCK_SECONDS = 0.1;
+static const float ARCHIVE_KBPS = 3.0f;
+
+// Harmonics with a moving pitch and bursts of noise, over two and a half chunks
+static std::vector<float> synthetic_audio(int sample_rate) {
+    std::vector<float> audio((size_t) (2.5 * AUDIO_ARCHIVE_CHUNK_SECONDS * sample_rate));
+    uint32_t seed = 1;
+    double phase = 0.0;
+    for (size_t i = 0; i < audio.size(); i++) {
+        const double t = (double) i / sample_rate;
+        phase += 2.0 * M_PI * (140.0 + 40.0 * sin(2.0 * M_PI * 0.7 * t)) / sample_rate;
+        double x = 0.0;
+        for (int h = 1; h <= 8; h++) x += sin(h * phase) / h;
+        seed = seed * 1664525u + 1013904223u;
+        const double noise = ((seed >> 8) / 16777216.0 - 0.5) * (fmod(t, 0.5) < 0.1 ? 0.5 : 0.02);
+        audio[i] = (float) (0.2 * x * (0.6 + 0.4 * sin(2.0 * M_PI * 2.0 * t)) + noise);
+    }
+    return audio;
+}
+
+// Signal to noise ratio of the decoded audio in dB, over the samples both have
+static double snr_db(const float* ref, const float* audio, size_t n) {
+    double signal = 0.0, noise = 0.0;
+    for (size_t i = 0; i < n; i++) {
+        signal += (double) ref[i] * ref[i];
+        noise += (double) (audio[i] - ref[i]) * (audio[i] - ref[i]);
+    }
+    return 10.0 * log10(signal / std::max(noise, 1e-20));
+}
+
+int main(int argc, char** argv) {
+    if (argc < 4) {
+        fprintf(stderr, "usage: %s encodec.bin offset archive.encz [input.wav] [output.wav]\n", argv[0]);
+        return 1;
+    }
+    const char* model_path = argv[1];
+    const int offset = atoi(argv[2]);
+    const char* archive_path = argv[3];
+    const char* input_path = argc > 4 ? argv[4] : NULL;
+    const char* output_path = argc > 5 ? argv[5] : NULL;
+    const int n_threads = 4;
+
+    // Input audio, mono
+    std::vector<float> input;
+    unsigned int input_rate = AUDIO_ARCHIVE_SAMPLE_RATE;
+    if (input_path) {
+        unsigned int channels;
+        drwav_uint64 n_frames;
+        float* data = drwav_open_file_and_read_pcm_frames_f32(input_path, &channels, &input_rate, &n_frames, NULL);
+        if (!data) {
+            fprintf(stderr, "%s: Could not read %s\n", __func__, input_path);
+            return 1;
+        }
+        input.resize(n_frames);
+        for (drwav_uint64 i = 0; i < n_frames; i++) input[i] = data[i * channels];
+        drwav_free(data, NULL);
+    } else {
+        input = synthetic_audio(input_rate);
+    }
+    const double duration = (double) input.size() / input_rate;
+
+    // Record, with a model of its own as stream.cpp
+    struct encodec_context* ectx = encodec_load_model(model_path, offset, 0);
+    if (!ectx) {
+        fprintf(stderr, "%s: Could not load %s\n", __func__, model_path);
+        return 1;
+    }
+    AudioArchiveWriter writer;
+    if (!open_audio_archive(&writer, archive_path, ectx, ARCHIVE_KBPS, input_rate, n_threads)) return 1;
+    const size_t block = (size_t) (BLOCK_SECONDS * input_rate);
+    for (size_t i = 0; i < input.size(); i += block) {
+        if (!write_audio_archive(&writer, input.data() + i, (int) std::min(block, input.size() - i))) {
+            close_audio_archive(&writer);
+            return 1;
+        }
+    }
+    if (!close_audio_archive(&writer)) return 1;
+
+    // Read back whole, then from the middle of the second chunk
+    AudioArchiveReader reader;
+    if (!open_audio_archive_reader(&reader, archive_path)) return 1;
+    std::vector<float> audio, part;
+    const double t_part = 1.5 * AUDIO_ARCHIVE_CHUNK_SECONDS;
+    bool ok = read_audio_archive(&reader, ectx, 0.0, duration, &audio, n_threads) &&
+              read_audio_archive(&reader, ectx, t_part, duration, &part, n_threads);
+    const double archive_duration = audio_archive_duration(&reader);
+    fseek(reader.file, 0, SEEK_END);
+    const long archive_size = ftell(reader.file);
+    const size_t n_chunks = reader.index.size();
+    close_audio_archive_reader(&reader);
+    encodec_free(ectx);
+    if (!ok) return 1;
+
+    printf("%s: %.2f s in %zu chunks, %ld bytes, %.2f kbps\n", archive_path, archive_duration, n_chunks, archive_size,
+           archive_size * 8 / 1000.0 / std::max(archive_duration, 1e-3));
+    if (fabs(archive_duration - duration) * AUDIO_ARCHIVE_SAMPLE_RATE > 1.0) {
+        fprintf(stderr, "%s: The archive has %.3f s of the %.3f s recorded\n", __func__, archive_duration, duration);
+        return 1;
+    }
+
+    // The part is decoded from the chunk before it, so it only differs from the whole while the
+    // decoder catches up with the state of the audio before
+    const size_t part_start = audio.size() - part.size();
+    double max_diff = 0.0;
+    for (size_t i = 0; i < part.size(); i++) max_diff = std::max(max_diff, (double) fabsf(part[i] - audio[part_start + i]));
+    printf("read from %.1f s: max difference with the whole %.6f\n", t_part, max_diff);
+    if (input_rate == AUDIO_ARCHIVE_SAMPLE_RATE) {
+        printf("SNR %.2f dB\n", snr_db(input.data(), audio.data(), std::min(input.size(), audio.size())));
+    }
+
+    if (output_path) write_wav_on_disk(audio, output_path);
+    return 0;
+}
@@ -4,12 +4,22 @@
 #include "bark.h"
 #include "common2.h"
 #include "ggml.h"
+#include "speech_cache.h"
+#include "cpu_pool.h"
 
 // Text colors
 const std::string DARK_GREEN = "\033[32;2m";
 const std::string RESET = "\033[0m";
 
 void bark_print_progress_callback(struct bark_context *bctx, enum bark_encoding_step step, int progress, void *user_data);
+bool bark_audio_chunk_callback(struct bark_context *bctx, const float *audio, int n_samples, void *user_data);
+
+// Audio received while generating
+typedef struct {
+    std::vector<float> audio;
+    int64_t t_start_us;
+    int64_t t_first_us;
+} BarkStream;
 
 int mainBark(int argc, char **argv) {
     // Time
@@ -27,31 +37,49 @@ int mainBark(int argc, char **argv) {
     // Initialize bark
     struct bark_context_params ctx_params = bark_context_default_params();
     ctx_params.verbosity = verbosity;
+    // Short replies: budget the semantic tokens by text length and stop once EOS keeps rising
+    ctx_params.text_rate_hz = 2.0f;
+    ctx_params.eos_patience = 3;
     ctx_params.progress_callback = bark_print_progress_callback;
     ctx_params.progress_callback_user_data = nullptr;
+    ctx_params.threadpool = shared_cpu_pool(params.n_threads);
+    ctx_params.threadpool_lane = CPU_LANE_SYNTHESIS;
     struct bark_context *bctx = bark_load_model(params.model_path.c_str(), ctx_params, params.seed);
     if (!bctx) {
         fprintf(stderr, "%s: Could not load model\n", __func__);
         exit(1);
     }
 
-    // Generate audio
-    if (!bark_generate_audio(bctx, params.prompt.c_str(), params.n_threads)) {
-        fprintf(stderr, "%s: An error occured. If the problem persists, feel free to open an issue to report it.\n", __func__);
-        exit(1);
+    // Open phrase cache, and generate the phrases that are not cached yet
+    SpeechCache cache;
+    bool use_cache = !params.cache_dir.empty() && open_speech_cache(&cache, params.cache_dir.c_str(), params.model_path.c_str(), (size_t) params.cache_size_mb << 20);
+    if (use_cache && !params.phrases_path.empty()) {
+        int n_warmed = warm_speech_cache(&cache, bctx, &ctx_params, params.seed, params.phrases_path.c_str(), params.n_threads);
+        if (n_warmed > 0) printf("%s: Cached %d phrases\n", __func__, n_warmed);
     }
 
-    // Get audio
-    const float *audio_data = bark_get_audio_data(bctx);
-    if (audio_data == NULL) {
-        fprintf(stderr, "%s: Could not get audio data\n", __func__);
-        exit(1);
+    // Play cached audio without running the model
+    BarkStream stream = { {}, ggml_time_us(), 0 };
+    uint64_t key = use_cache ? speech_cache_key(&cache, params.prompt.c_str(), &ctx_params, params.seed) : 0;
+    CachedSpeech speech;
+    if (use_cache && find_speech(&cache, key, &speech)) {
+        bark_audio_chunk_callback(bctx, speech.samples, speech.n_samples, &stream);
+        release_speech(&speech);
+    } else {
+        // Generate audio, in chunks as it is generated
+        if (!generate_speech(bctx, params.prompt.c_str(), params.seed, params.n_threads, bark_audio_chunk_callback, &stream)) {
+            fprintf(stderr, "%s: An error occured. If the problem persists, feel free to open an issue to report it.\n", __func__);
+            exit(1);
+        }
+        if (stream.audio.empty()) {
+            fprintf(stderr, "%s: Could not get audio data\n", __func__);
+            exit(1);
+        }
+        if (use_cache) store_speech(&cache, key, stream.audio.data(), stream.audio.size(), ctx_params.sample_rate);
     }
 
     // Write wav
-    const int audio_arr_size = bark_get_audio_data_size(bctx);
-    std::vector<float> audio_arr(audio_data, audio_data + audio_arr_size);
-    write_wav_on_disk(audio_arr, params.dest_wav_path);
+    write_wav_on_disk(stream.audio, params.dest_wav_path);
 
     // Report timing
     const int64_t t_main_end_us = ggml_time_us();
@@ -60,6 +88,7 @@ int mainBark(int argc, char **argv) {
     printf("\n\n");
     printf("%s:     load time = %8.2f ms\n", __func__, t_load_us / 1000.0f);
     printf("%s:     eval time = %8.2f ms\n", __func__, t_eval_us / 1000.0f);
+    printf("%s:  first audio = %8.2f ms\n", __func__, (stream.t_first_us - stream.t_start_us) / 1000.0f);
     printf("%s:    total time = %8.2f ms\n", __func__, (t_main_end_us - t_main_start_us) / 1000.0f);
 
     // Done
@@ -78,3 +107,9 @@ void bark_print_progress_callback(struct bark_context *bctx, enum bark_encoding_
     fflush(stdout);
 }
 
+bool bark_audio_chunk_callback(struct bark_context *bctx, const float *audio, int n_samples, void *user_data) {
+    BarkStream* stream = (BarkStream*) user_data;
+    if (stream->audio.empty()) stream->t_first_us = ggml_time_us();
+    stream->audio.insert(stream->audio.end(), audio, audio + n_samples);
+    return true;
+}
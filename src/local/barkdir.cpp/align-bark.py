@@ -0,0 +1,129 @@
+"""Align the tensor data of a Bark ggml model so it can be used in place when memory mapped.
+
+The Bark ggml format packs tensors without padding, so most tensor data ends up at offsets
+the CPU backend cannot use directly, and bark.cpp copies those tensors instead. This rewrites
+the file with each tensor name padded with zero bytes, so that every tensor's data starts at
+a multiple of the alignment. The loaders strip the padding from the names, and the aligned
+file still loads without memory mapping.
+
+The file is structured as follows:
+    - Magic (`ggml` in binary format)
+    - Vocabulary        (int n_vocab, then per token: uint length, char[length])
+    - Text model        (int[10] hyperparameters, int n_tensors, tensors)
+    - Coarse model      (int[10] hyperparameters, int n_tensors, tensors)
+    - Fine model        (int[10] hyperparameters, int n_tensors, tensors)
+    - Encodec model     (Magic, int[9] hyperparameters, tensors up to the end of the file)
+
+For each tensor, the bytes are packed as follows:
+    - Number of dimensions    (int)
+    - Name length             (int)
+    - Type                    (int)
+    - Dimensions              (int[n_dims])
+    - Name                    (char[name_length])
+    - Data
+
+Example
+-------
+```bash
+    python align-bark.py ./ggml_weights/ggml_weights.bin ./ggml_weights/ggml_weights_aligned.bin
+```
+"""
+import argparse
+import struct
+
+# Block size and bytes per block of the ggml types used by Bark models
+GGML_TYPES = {
+    0: (1, 4),    # F32
+    1: (1, 2),    # F16
+    2: (32, 18),  # Q4_0
+    3: (32, 20),  # Q4_1
+    6: (32, 22),  # Q5_0
+    7: (32, 24),  # Q5_1
+    8: (32, 34),  # Q8_0
+}
+
+GGML_MAGIC = 0x67676D6C
+
+parser = argparse.ArgumentParser()
+parser.add_argument("input", type=str, help="Bark ggml model to align")
+parser.add_argument("output", type=str, help="aligned Bark ggml model")
+parser.add_argument("--alignment", type=int, default=32, help="alignment of the tensor data in bytes")
+
+
+def copy(fin, fout, n):
+    data = fin.read(n)
+    if len(data) != n:
+        raise ValueError("Unexpected end of file")
+    fout.write(data)
+    return data
+
+
+def copy_magic(fin, fout):
+    magic = struct.unpack("<I", copy(fin, fout, 4))[0]
+    if magic != GGML_MAGIC:
+        raise ValueError("Not a ggml model")
+
+
+def align_tensor(fin, fout, alignment):
+    """Copy a tensor with its name padded, returns False at the end of the file."""
+    header = fin.read(12)
+    if len(header) == 0:
+        return False
+    n_dims, length, ttype = struct.unpack("<iii", header)
+    if ttype not in GGML_TYPES:
+        raise ValueError("Unsupported tensor type %d" % ttype)
+    dims = fin.read(4 * n_dims)
+    name = fin.read(length).rstrip(b"\0")
+
+    n_elements = 1
+    for ne in struct.unpack("<%di" % n_dims, dims):
+        n_elements *= ne
+    block, size = GGML_TYPES[ttype]
+    n_bytes = n_elements // block * size
+
+    # Pad the name so the data starts aligned
+    pad = -(fout.tell() + 12 + len(dims) + len(name)) % alignment
+    name += b"\0" * pad
+
+    fout.write(struct.pack("<iii", n_dims, len(name), ttype))
+    fout.write(dims)
+    fout.write(name)
+    copy(fin, fout, n_bytes)
+    return True
+
+
+def align_model(fin, fout, alignment):
+    copy_magic(fin, fout)
+
+    # Vocabulary
+    n_vocab = struct.unpack("<i", copy(fin, fout, 4))[0]
+    for _ in range(n_vocab):
+        length = struct.unpack("<I", copy(fin, fout, 4))[0]
+        copy(fin, fout, length)
+
+    # Text, coarse and fine models
+    n_tensors = 0
+    for _ in range(3):
+        copy(fin, fout, 10 * 4)
+        n = struct.unpack("<i", copy(fin, fout, 4))[0]
+        for _ in range(n):
+            if not align_tensor(fin, fout, alignment):
+                raise ValueError("Unexpected end of file")
+        n_tensors += n
+
+    # Encodec model
+    copy_magic(fin, fout)
+    copy(fin, fout, 9 * 4)
+    while align_tensor(fin, fout, alignment):
+        n_tensors += 1
+
+    return n_tensors
+
+
+if __name__ == "__main__":
+    args = parser.parse_args()
+
+    with open(args.input, "rb") as fin, open(args.output, "wb") as fout:
+        n_tensors = align_model(fin, fout, args.alignment)
+
+    print("Aligned %d tensors to %d bytes" % (n_tensors, args.alignment))
@@ -1,6 +1,7 @@
 #include "ggml-alloc.h"
 #include "ggml-backend.h"
 #include "ggml.h"
+#include "ggml-cpu.h"
 
 #ifdef GGML_USE_CUDA
 #include "ggml-cuda.h"
@@ -10,23 +11,44 @@
 #include "ggml-metal.h"
 #endif
 
+#include <algorithm>
 #include <cassert>
+#include <cctype>
 #include <cmath>
 #include <cstdio>
 #include <cstring>
 #include <fstream>
 #include <map>
+#include <memory>
+#include <numeric>
 #include <random>
 #include <regex>
 #include <string>
 #include <thread>
 #include <vector>
 
+#if defined(__unix__) || defined(__APPLE__)
+#include <unistd.h>
+#if defined(_POSIX_MAPPED_FILES)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#define BARK_USE_MMAP
+#endif
+#endif
+
 #include "bark.h"
 #include "encodec.h"
+#include "sampler.h"
 
 #define BARK_MAX_NODES 4096
 
+// positions of the KV cache the step graph attends to are a multiple of this
+#define BARK_KV_BLOCK 64
+
+// rows of logits sampled together by a thread with their own random generator
+#define BARK_SAMPLE_CHUNK 64
+
 #define EPS_NORM 1e-5f
 
 #define MAX(a, b) ((a) > (b) ? (a) : (b))
@@ -38,12 +60,29 @@ typedef int32_t bark_token;
 typedef std::vector<int32_t> bark_sequence;
 typedef std::vector<std::vector<int32_t>> bark_codes;
 
+// The tokens are stored back to back, and looked up with a trie whose nodes keep their edges
+// contiguous and sorted by byte
+struct bark_vocab_node {
+    int32_t  id = -1;  // token ending at this node, -1 if none
+    uint32_t first_edge = 0;
+    uint32_t n_edges = 0;
+};
+
+struct bark_vocab_edge {
+    uint8_t  c;
+    uint32_t node;
+};
+
 struct bark_vocab {
     using id    = int32_t;
     using token = std::string;
 
-    std::map<token, id> token_to_id;
-    std::map<id, token> id_to_token;
+    // text of token i is text[offsets[i], offsets[i + 1])
+    std::vector<char>     text;
+    std::vector<uint32_t> offsets;
+
+    std::vector<bark_vocab_node> nodes;  // nodes[0] is the root
+    std::vector<bark_vocab_edge> edges;
 };
 
 struct gpt_hparams {
@@ -98,16 +137,40 @@ struct gpt_model {
     std::vector<gpt_layer> layers;
 
     // key + value memory
-    struct ggml_tensor * memory_k;
-    struct ggml_tensor * memory_v;
+    struct ggml_tensor * memory_k = NULL;
+    struct ggml_tensor * memory_v = NULL;
+
+    // positions held by the KV cache, for each of n_seq_kv sequences
+    int n_ctx_kv = 0;
+    int n_seq_kv = 0;
 
     struct ggml_context * ctx_w;
     struct ggml_context * ctx_kv;
 
     ggml_backend_t backend = NULL;
 
-    ggml_backend_buffer_t buffer_w;
-    ggml_backend_buffer_t buffer_kv;
+    ggml_backend_buffer_t buffer_w = NULL;
+    ggml_backend_buffer_t buffer_kv = NULL;
+
+    // weights used in place from the memory mapped model file
+    ggml_backend_buffer_t buffer_mapped = NULL;
+
+    // Q4_0 weights of the matrix products, repacked for the aarch64 kernels
+    ggml_backend_buffer_t buffer_repacked = NULL;
+
+    // graph allocator, reserved for the first prompt at load and grown for longer prompts
+    ggml_gallocr_t allocr = NULL;
+
+    // memory of the graphs and of their ggml_tensor structs, the next graph built reuses it
+    std::vector<uint8_t> buf_graph;
+
+    // step graph, one token for each of n_step_seq sequences attending to the first n_step_kv
+    // positions, built and allocated once and reused for every step until either changes
+    struct ggml_cgraph * gf_step = NULL;
+    ggml_gallocr_t allocr_step = NULL;
+    std::vector<uint8_t> buf_step;
+    int n_step_seq = 0;
+    int n_step_kv = 0;
 
     std::map<std::string, struct ggml_tensor*> tensors;
 
@@ -130,20 +193,99 @@ struct bark_model {
     struct bark_vocab vocab;
 };
 
+// Model file, read through a read-only mapping when possible or else through a stream.
+// The mapping is shared by the GPT and Encodec loaders, and CPU weights whose data is
+// aligned in the file are used in place, so it is kept for the lifetime of the context.
+struct bark_model_file {
+    std::ifstream fin;
+
+    const char * addr = NULL;
+    size_t size = 0;
+    size_t pos  = 0;
+
+    bark_model_file() = default;
+    bark_model_file(const bark_model_file &) = delete;
+    bark_model_file & operator=(const bark_model_file &) = delete;
+
+    bool open(const std::string & fname, bool use_mmap, bool prefetch) {
+#ifdef BARK_USE_MMAP
+        if (use_mmap) {
+            const int fd = ::open(fname.c_str(), O_RDONLY);
+            struct stat st;
+            if (fd >= 0 && fstat(fd, &st) == 0 && st.st_size > 0) {
+                int flags = MAP_SHARED;
+#ifdef __linux__
+                if (prefetch) {
+                    flags |= MAP_POPULATE;
+                }
+#endif
+                void * ptr = mmap(NULL, st.st_size, PROT_READ, flags, fd, 0);
+                if (ptr != MAP_FAILED) {
+                    if (prefetch) {
+                        posix_madvise(ptr, st.st_size, POSIX_MADV_WILLNEED);
+                    }
+                    addr = (const char *) ptr;
+                    size = st.st_size;
+                }
+            }
+            if (fd >= 0) {
+                ::close(fd);
+            }
+            if (addr) {
+                return true;
+            }
+            fprintf(stderr, "%s: failed to mmap '%s', reading it instead\n", __func__, fname.c_str());
+        }
+#endif
+        fin.open(fname, std::ios::binary);
+        return (bool) fin;
+    }
+
+    void read(void * dst, size_t n) {
+        if (!addr) {
+            fin.read((char *) dst, n);
+            return;
+        }
+        memcpy(dst, addr + std::min(pos, size), std::min(n, size - std::min(pos, size)));
+        pos += n;
+    }
+
+    size_t tell() {
+        return addr ? pos : (size_t) fin.tellg();
+    }
+
+    ~bark_model_file() {
+#ifdef BARK_USE_MMAP
+        if (addr) {
+            munmap((void *) addr, size);
+        }
+#endif
+    }
+};
+
 struct bark_context {
     struct bark_model text_model;
 
-    struct encodec_context * encodec_ctx;
+    // mapping of the model file, the weights may point into it
+    std::unique_ptr<bark_model_file> model_file;
 
-    // buffer for model evaluation
-    ggml_backend_buffer_t buf_compute;
+    struct encodec_context * encodec_ctx;
 
-    // custom allocator
-    ggml_gallocr_t allocr = NULL;
     int n_gpu_layers = 0;
 
+    // seed given at load, and generator of the single text generations
+    uint32_t seed = 0;
     std::mt19937 rng;
 
+    // sampling scratch, reused for every token
+    struct bark_sampler sampler;
+
+    // sampling scratch of the threads sampling the fine tokens
+    std::vector<struct bark_sampler> samplers;
+
+    // memory of the graph sampling the fine tokens and of its ggml_tensor structs
+    std::vector<uint8_t> buf_sample;
+
     bark_sequence tokens;
     bark_sequence semantic_tokens;
 
@@ -153,6 +295,12 @@ struct bark_context {
     float * generated_audio = NULL;
     int n_generated_samples = 0;
 
+    // audio of all the chunks when streaming
+    std::vector<float> streamed_audio;
+
+    // audio of each text of the last batch
+    std::vector<std::vector<float>> batch_audio;
+
     // hyperparameters
     bark_context_params params;
 
@@ -163,11 +311,31 @@ struct bark_context {
     bark_statistics stats;
 };
 
+// state of a streaming generation
+struct bark_stream {
+    bark_audio_callback callback;
+    void * user_data;
+
+    // fine tokens of the frames already decoded, [seq_length][n_codes]
+    bark_codes fine_tokens;
+
+    // time spent on the fine encoder and Encodec
+    int64_t t_decode_us = 0;
+
+    // the callback asked to stop
+    bool stopped = false;
+};
+
 template <typename T>
 static void read_safe(std::ifstream& fin, T& dest) {
     fin.read((char*)&dest, sizeof(T));
 }
 
+template <typename T>
+static void read_safe(bark_model_file& file, T& dest) {
+    file.read(&dest, sizeof(T));
+}
+
 template <typename T>
 static void write_safe(std::ofstream& fout, T& dest) {
     fout.write((char*)&dest, sizeof(T));
@@ -181,92 +349,144 @@ static void bark_print_statistics(gpt_model* model) {
     printf("\n");
 }
 
-static void softmax(std::vector<float>& logits) {
-    // for numerical stability
-    float maxl = -INFINITY;
-    for (const auto& l : logits)
-        maxl = std::max(maxl, l);
+static bark_token gpt_sample(
+    struct bark_context * bctx,
+    gpt_model           & model,
+    std::mt19937        & rng,
+    const float         * logits,
+    int                   n_logits,
+    float                 temp,
+    int                   top_k,
+    float                 top_p,
+    float               * eos_p) {
+    int64_t t_sample_start_us = ggml_time_us();
+
+    bark_token res = bark_sampler_sample(
+        bctx->sampler, logits, n_logits, rng, temp, top_k, top_p, eos_p);
 
-    // softmax
-    float sum = 0.0;
-    for (auto& l : logits) {
-        l = exp(l - maxl);
-        sum += l;
-    }
+    int64_t t_sample_end_us = ggml_time_us();
+    model.t_sample_us += (t_sample_end_us - t_sample_start_us);
+    model.n_sample += 1;
 
-    for (auto& l : logits)
-        l /= sum;
+    return res;
 }
 
-static bark_token gpt_multinomial_sample(
-        std::vector<float> & logits,
-        std::mt19937       & rng,
-        float                temp,
-        float              * eos_p) {
-    int n_logits = logits.size();
-
-    for (int i = 0; i < n_logits; ++i)
-        logits[i] /= temp;
+// Sample the rows of chunks c0, c0 + dc, ... of the logits. Each chunk of rows has its own
+// generator seeded from (seed, chunk), so the tokens do not depend on the number of threads.
+static void bark_sample_chunks(
+    bark_sampler & sampler,
+    const float  * logits,
+    int            n_rows,
+    int            row_size,
+    int            n_logits,
+    float          temp,
+    uint32_t       seed,
+    bark_token   * tokens,
+    int            c0,
+    int            dc) {
+    const int n_chunks = (n_rows + BARK_SAMPLE_CHUNK - 1) / BARK_SAMPLE_CHUNK;
+
+    for (int c = c0; c < n_chunks; c += dc) {
+        std::seed_seq seq = { seed, (uint32_t) c };
+        std::mt19937 rng_chunk(seq);
+
+        const int i_end = std::min(n_rows, (c + 1) * BARK_SAMPLE_CHUNK);
+        for (int i = c * BARK_SAMPLE_CHUNK; i < i_end; i++) {
+            tokens[i] = bark_sampler_sample(sampler, logits + (size_t) i * row_size, n_logits, rng_chunk, temp, 0, 1.0f, NULL);
+        }
+    }
+}
 
-    softmax(logits);
+struct bark_sample_rows_params {
+    bark_sampler * samplers; // scratch of each thread
+    int            n_samplers;
+    int            n_logits;
+    float          temp;
+    uint32_t       seed;
+};
 
-    std::discrete_distribution<bark_token> dist(logits.begin(), logits.end());
-    int next = dist(rng);
+// tokens = sample(logits), dst is the token tensor [n_rows] and b the logits [row_size, n_rows]
+static void bark_sample_rows_op(
+        struct ggml_tensor       * dst,
+        const struct ggml_tensor * a,
+        const struct ggml_tensor * b,
+        int ith, int nth, void * userdata) {
+    const bark_sample_rows_params * p = (const bark_sample_rows_params *) userdata;
 
-    // likelihood of EOS token
-    if (eos_p)
-        *eos_p = logits[logits.size() - 1];
+    nth = std::min(nth, p->n_samplers);
+    if (ith >= nth) {
+        return;
+    }
 
-    return next;
+    bark_sample_chunks(
+        p->samplers[ith], (const float *) b->data, b->ne[1], b->nb[1] / sizeof(float), p->n_logits, p->temp, p->seed,
+        (bark_token *) dst->data, ith, nth);
 }
 
-static bark_token gpt_argmax_sample(std::vector<float>& logits, float* eos_p) {
-    int n_logits = logits.size();
+// Sample a token from each of n_rows rows of logits. The rows are sampled as a graph on the
+// CPU backend of the model, so they run on its threads, in the lane of its threadpool when
+// it has one, instead of on threads started for each call. A single chunk of rows is
+// sampled on the calling thread.
+static void gpt_sample_rows(
+    struct bark_context * bctx,
+    gpt_model           & model,
+    std::mt19937        & rng,
+    const float         * logits,
+    int                   n_rows,
+    int                   row_size,
+    int                   n_logits,
+    float                 temp,
+    bark_token          * tokens,
+    int                   n_threads) {
+    int64_t t_sample_start_us = ggml_time_us();
 
-    // testing purposes
-    for (auto& l : logits)
-        l /= 0.7f;
+    const uint32_t seed     = rng();
+    const int      n_chunks = (n_rows + BARK_SAMPLE_CHUNK - 1) / BARK_SAMPLE_CHUNK;
 
-    // likelihood of EOS token
-    softmax(logits);
+    n_threads = std::max(1, std::min(n_threads, n_chunks));
 
-    if (eos_p)
-        *eos_p = logits[logits.size() - 1];
+    if (n_threads == 1 || !ggml_backend_is_cpu(model.backend)) {
+        bark_sample_chunks(bctx->sampler, logits, n_rows, row_size, n_logits, temp, seed, tokens, 0, 1);
+    } else {
+        if ((int) bctx->samplers.size() < n_threads) {
+            bctx->samplers.resize(n_threads);
+        }
 
-    int next = 0;
-    float maxl = -INFINITY;
+        bark_sample_rows_params params = { bctx->samplers.data(), n_threads, n_logits, temp, seed };
 
-    for (int i = 0; i < n_logits; i++) {
-        if (logits[i] > maxl) {
-            maxl = logits[i];
-            next = i;
-        }
-    }
+        const size_t buf_size = 3 * ggml_tensor_overhead() + ggml_graph_overhead_custom(4, false);
+        auto & buf = bctx->buf_sample;
+        buf.resize(buf_size);
 
-    return next;
-}
+        struct ggml_init_params ggml_params = {
+            /*.mem_size   =*/ buf_size,
+            /*.mem_buffer =*/ buf.data(),
+            /*.no_alloc   =*/ true,
+        };
 
-static bark_token gpt_sample(
-    std::vector<float> & logits,
-    std::mt19937       & rng,
-    float                temp,
-    float              * eos_p,
-    int64_t            * t_sample_us,
-    int64_t            * n_sample) {
-    int64_t t_sample_start_us = ggml_time_us();
+        struct ggml_context * ctx0 = ggml_init(ggml_params);
 
-    bark_token res;
-    if (temp == 0.0f) {
-        res = gpt_argmax_sample(logits, eos_p);
-    } else {
-        res = gpt_multinomial_sample(logits, rng, temp, eos_p);
+        // the tensors use the caller's memory
+        struct ggml_tensor * in = ggml_new_tensor_2d(ctx0, GGML_TYPE_F32, row_size, n_rows);
+        in->data = (void *) logits;
+
+        struct ggml_tensor * out = ggml_new_tensor_1d(ctx0, GGML_TYPE_I32, n_rows);
+        out->data = tokens;
+
+        out = ggml_map_custom2_inplace(ctx0, out, in, bark_sample_rows_op, n_threads, &params);
+
+        struct ggml_cgraph * gf = ggml_new_graph_custom(ctx0, 4, false);
+        ggml_build_forward_expand(gf, out);
+
+        ggml_backend_cpu_set_n_threads(model.backend, n_threads);
+        ggml_backend_graph_compute(model.backend, gf);
+
+        ggml_free(ctx0);
     }
 
     int64_t t_sample_end_us = ggml_time_us();
-    *t_sample_us += (t_sample_end_us - t_sample_start_us);
-    *n_sample += 1;
-
-    return res;
+    model.t_sample_us += (t_sample_end_us - t_sample_start_us);
+    model.n_sample += n_rows;
 }
 
 static bool ggml_quantize_weights(
@@ -349,6 +569,10 @@ static bool ggml_quantize_weights(
         std::string name(length, 0);
         fin.read(&name[0], length);
 
+        // names may be padded with zeros to align the data
+        name.resize(strnlen(name.data(), length));
+        length = name.size();
+
         printf("%64s - [%5d, %5d, %5d], type = %6s ", name.data(), ne[0], ne[1], ne[2], ggml_type_name((ggml_type)ttype));
 
         bool quantize = false;
@@ -477,6 +701,15 @@ static bool ggml_quantize_weights(
     return true;
 }
 
+// ASCII letter of the accented latin letters, indexed by the second byte of their UTF-8
+// encoding 0xC3 0x80 to 0xC3 0xBF, 0 for the characters left as they are
+static const char accent_table[64] = {
+    'A', 'A', 'A', 'A', 'A', 'A',  0,  'C', 'E', 'E', 'E', 'E', 'I', 'I', 'I', 'I',
+     0,  'N', 'O', 'O', 'O', 'O', 'O',  0,   0,  'U', 'U', 'U', 'U', 'Y',  0,   0,
+    'a', 'a', 'a', 'a', 'a', 'a',  0,  'c', 'e', 'e', 'e', 'e', 'i', 'i', 'i', 'i',
+     0,  'n', 'o', 'o', 'o', 'o', 'o',  0,   0,  'u', 'u', 'u', 'u', 'y',  0,   0,
+};
+
 static size_t utf8_len(char src) {
     const size_t lookup[] = {1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 3, 4};
     uint8_t highbits = static_cast<uint8_t>(src) >> 4;
@@ -485,134 +718,106 @@ static size_t utf8_len(char src) {
 
 static std::string strip_accents(const std::string& in_str) {
     std::string out_str;
-    std::map<std::string, char> accent_map = {
-        {"À", 'A'},
-        {"Á", 'A'},
-        {"Â", 'A'},
-        {"Ã", 'A'},
-        {"Ä", 'A'},
-        {"Å", 'A'},
-        {"à", 'a'},
-        {"á", 'a'},
-        {"â", 'a'},
-        {"ã", 'a'},
-        {"ä", 'a'},
-        {"å", 'a'},
-        {"È", 'E'},
-        {"É", 'E'},
-        {"Ê", 'E'},
-        {"Ë", 'E'},
-        {"è", 'e'},
-        {"é", 'e'},
-        {"ê", 'e'},
-        {"ë", 'e'},
-        {"Ì", 'I'},
-        {"Í", 'I'},
-        {"Î", 'I'},
-        {"Ï", 'I'},
-        {"ì", 'i'},
-        {"í", 'i'},
-        {"î", 'i'},
-        {"ï", 'i'},
-        {"Ò", 'O'},
-        {"Ó", 'O'},
-        {"Ô", 'O'},
-        {"Õ", 'O'},
-        {"Ö", 'O'},
-        {"ò", 'o'},
-        {"ó", 'o'},
-        {"ô", 'o'},
-        {"õ", 'o'},
-        {"ö", 'o'},
-        {"Ù", 'U'},
-        {"Ú", 'U'},
-        {"Û", 'U'},
-        {"Ü", 'U'},
-        {"ù", 'u'},
-        {"ú", 'u'},
-        {"û", 'u'},
-        {"ü", 'u'},
-        {"Ý", 'Y'},
-        {"ý", 'y'},
-        {"Ç", 'C'},
-        {"ç", 'c'},
-        {"Ñ", 'N'},
-        {"ñ", 'n'},
-    };
+    out_str.reserve(in_str.size());
 
     for (size_t i = 0; i < in_str.length();) {
-        int len = utf8_len(in_str[i]);
-        std::string cur = in_str.substr(i, len);
-        auto iter = accent_map.find(cur);
-        if (iter != accent_map.end())
-            out_str += iter->second;
-        else
-            out_str += cur;
+        size_t len = utf8_len(in_str[i]);
+        if (len == 2 && (uint8_t) in_str[i] == 0xC3 && i + 1 < in_str.length()) {
+            const uint8_t c = in_str[i + 1];
+            if (c >= 0x80 && c < 0xC0 && accent_table[c - 0x80]) {
+                out_str += accent_table[c - 0x80];
+                i += len;
+                continue;
+            }
+        }
 
+        out_str.append(in_str, i, len);
         i += len;
     }
 
     return out_str;
 }
 
+// child of a trie node by the next byte, -1 if there is none
+static int64_t bark_vocab_child(const bark_vocab * vocab, uint32_t node, uint8_t c) {
+    const auto & n = vocab->nodes[node];
+
+    const bark_vocab_edge * first = vocab->edges.data() + n.first_edge;
+    const bark_vocab_edge * last  = first + n.n_edges;
+    const bark_vocab_edge * it = std::lower_bound(first, last, c,
+        [](const bark_vocab_edge & e, uint8_t c) { return e.c < c; });
+
+    if (it == last || it->c != c) {
+        return -1;
+    }
+    return it->node;
+}
+
 void bert_tokenize(
     const bark_vocab * vocab,
     const char       * text,
     int32_t          * tokens,
     int32_t          * n_tokens,
     int32_t            n_max_tokens) {
-    std::string str = text;
-    std::vector<std::string> words;
+    const std::string str = strip_accents(text);
 
     int32_t t = 0;
 
-    auto * token_map = &vocab->token_to_id;
-
-    // split the text into words
-    {
-        str = strip_accents(text);
-
-        std::string pat = R"([[:punct:]]|[[:alpha:]]+|[[:digit:]]+)";
-
-        std::regex re(pat);
-        std::smatch m;
-
-        while (std::regex_search(str, m, re)) {
-            for (std::string x : m)
-                words.push_back(x);
-            str = m.suffix();
+    // continuation tokens are below the node of "##"
+    int64_t cont = bark_vocab_child(vocab, 0, '#');
+    if (cont >= 0) {
+        cont = bark_vocab_child(vocab, cont, '#');
+    }
+
+    // split the text into words: a punctuation character, or a run of ASCII letters or digits,
+    // the other characters separate words
+    const char * s = str.data();
+    const int n_str = str.size();
+
+    for (int w = 0; w < n_str;) {
+        const unsigned char c = s[w];
+        int n = 1;
+        if (isalpha(c)) {
+            while (w + n < n_str && isalpha((unsigned char) s[w + n])) ++n;
+        } else if (isdigit(c)) {
+            while (w + n < n_str && isdigit((unsigned char) s[w + n])) ++n;
+        } else if (!ispunct(c)) {
+            ++w;
+            continue;
         }
-    }
 
-    // apply wordpiece
-    for (const auto& word : words) {
-        if (word.size() == 0)
-            continue;
+        const char * word = s + w;
+        w += n;
 
-        std::string prefix = "";
+        // apply wordpiece, the longest token matching at each position
+        int64_t start = 0;
         int i = 0;
-        int n = word.size();
 
-    loop:
         while (i < n) {
             if (t >= n_max_tokens - 1)
                 break;
-            int j = n;
-            while (j > i) {
-                auto it = token_map->find(prefix + word.substr(i, j - i));
-                if (it != token_map->end()) {
-                    tokens[t++] = it->second;
-                    i = j;
-                    prefix = "##";
-                    goto loop;
+
+            int32_t id = -1;
+            int j = i;
+
+            int64_t node = start;
+            for (int k = i; k < n && node >= 0; ++k) {
+                node = bark_vocab_child(vocab, node, word[k]);
+                if (node >= 0 && vocab->nodes[node].id >= 0) {
+                    id = vocab->nodes[node].id;
+                    j  = k + 1;
                 }
-                --j;
             }
-            if (j == i) {
-                fprintf(stderr, "%s: unknown token '%s'\n", __func__, word.substr(i, 1).data());
-                prefix = "##";
+
+            if (id >= 0) {
+                tokens[t++] = id;
+                i = j;
+            } else {
+                fprintf(stderr, "%s: unknown token '%c'\n", __func__, word[i]);
                 ++i;
             }
+
+            start = cont;
         }
     }
 
@@ -661,35 +866,127 @@ static void bark_tokenize_input(struct bark_context* bctx, const std::string& te
     printf("\n\n");
 }
 
-static bool bark_vocab_load(std::ifstream & fin, bark_vocab * vocab) {
+// Adds the node of the sorted tokens ids[lo, hi), which share their first depth bytes, and the
+// nodes below it. The edges of a node are reserved before its children are built.
+static uint32_t bark_vocab_build_node(
+        bark_vocab                   * vocab,
+        const std::vector<int32_t>   & ids,
+        size_t                         lo,
+        size_t                         hi,
+        size_t                         depth) {
+    auto len  = [&](int32_t id) { return vocab->offsets[id + 1] - vocab->offsets[id]; };
+    auto byte = [&](int32_t id) { return (uint8_t) vocab->text[vocab->offsets[id] + depth]; };
+
+    const uint32_t node = vocab->nodes.size();
+    vocab->nodes.emplace_back();
+
+    // the tokens ending here sort first, duplicates keep the last id
+    for (; lo < hi && len(ids[lo]) == depth; ++lo) {
+        vocab->nodes[node].id = ids[lo];
+    }
+
+    uint32_t n_edges = 0;
+    for (size_t i = lo; i < hi; ++i) {
+        if (i == lo || byte(ids[i]) != byte(ids[i - 1])) {
+            ++n_edges;
+        }
+    }
+
+    const uint32_t first_edge = vocab->edges.size();
+    vocab->edges.resize(first_edge + n_edges);
+    vocab->nodes[node].first_edge = first_edge;
+    vocab->nodes[node].n_edges    = n_edges;
+
+    for (uint32_t e = first_edge; lo < hi; ++e) {
+        const uint8_t c = byte(ids[lo]);
+        size_t end = lo + 1;
+        while (end < hi && byte(ids[end]) == c) {
+            ++end;
+        }
+
+        const uint32_t child = bark_vocab_build_node(vocab, ids, lo, end, depth + 1);
+        vocab->edges[e] = { c, child };
+        lo = end;
+    }
+
+    return node;
+}
+
+static bool bark_vocab_load(bark_model_file & fin, bark_vocab * vocab) {
     int32_t n_vocab;
     read_safe(fin, n_vocab);
 
-    std::string word;
-    std::vector<char> tmp;
+    if (n_vocab < 0) {
+        fprintf(stderr, "%s: invalid vocab size %d\n", __func__, n_vocab);
+        return false;
+    }
 
-    tmp.reserve(128);
+    vocab->text.clear();
+    vocab->offsets.resize(n_vocab + 1);
+    vocab->offsets[0] = 0;
 
     for (int i = 0; i < n_vocab; i++) {
         uint32_t len;
         read_safe(fin, len);
 
+        const size_t offset = vocab->text.size();
+        vocab->text.resize(offset + len);
         if (len > 0) {
-            tmp.resize(len);
-            fin.read(&tmp[0], tmp.size());  // read to buffer
-            word.assign(&tmp[0], tmp.size());
-        } else {
-            word = "";
+            fin.read(&vocab->text[offset], len);
         }
+        vocab->offsets[i + 1] = vocab->text.size();
+    }
 
-        vocab->token_to_id[word] = i;
-        vocab->id_to_token[i]    = word;
+    // sort the ids by token, then by id, and build the trie from the sorted ranges
+    std::vector<int32_t> ids(n_vocab);
+    for (int i = 0; i < n_vocab; i++) {
+        ids[i] = i;
     }
 
+    std::sort(ids.begin(), ids.end(), [&](int32_t a, int32_t b) {
+        const size_t len_a = vocab->offsets[a + 1] - vocab->offsets[a];
+        const size_t len_b = vocab->offsets[b + 1] - vocab->offsets[b];
+        const int cmp = memcmp(vocab->text.data() + vocab->offsets[a], vocab->text.data() + vocab->offsets[b], std::min(len_a, len_b));
+        if (cmp != 0) {
+            return cmp < 0;
+        }
+        return len_a != len_b ? len_a < len_b : a < b;
+    });
+
+    vocab->nodes.clear();
+    vocab->edges.clear();
+    vocab->nodes.reserve(vocab->text.size() + 1);
+    vocab->edges.reserve(vocab->text.size());
+
+    bark_vocab_build_node(vocab, ids, 0, ids.size(), 0);
+
     return true;
 }
 
-static bool bark_model_load(std::ifstream & fin,
+// buffer type repacking Q4_0 weights at load into the interleaved layout of the aarch64 GEMV
+// and GEMM kernels, NULL when the backend or the CPU has no such kernels
+static ggml_backend_buffer_type_t bark_repack_buffer_type(ggml_backend_t backend) {
+    if (!ggml_backend_is_cpu(backend) || !ggml_cpu_has_neon()) {
+        return NULL;
+    }
+
+    ggml_backend_dev_t dev = ggml_backend_get_device(backend);
+    auto * get_extra_bufts = (ggml_backend_dev_get_extra_bufts_t) ggml_backend_reg_get_proc_address(
+        ggml_backend_dev_backend_reg(dev), "ggml_backend_dev_get_extra_bufts");
+    if (!get_extra_bufts) {
+        return NULL;
+    }
+
+    for (ggml_backend_buffer_type_t * buft = get_extra_bufts(dev); *buft; buft++) {
+        if (ggml_backend_cpu_buft_is_aarch64(*buft)) {
+            return *buft;
+        }
+    }
+
+    return NULL;
+}
+
+static bool bark_model_load(bark_model_file & fin,
                             gpt_model     & model,
                             int             n_gpu_layers,
                             bark_verbosity_level verbosity) {
@@ -787,8 +1084,7 @@ static bool bark_model_load(std::ifstream & fin,
                      2 * n_layer +  // ln_1_g, ln_2_g
                      2 * n_layer +  // c_attn_attn_w, c_attn_proj_w
                      2 * n_layer +  // c_mlp_fc_w, c_mlp_proj_w
-                     n_lm_heads +   // lm_head
-                     2              // memory_k, memory_v
+                     n_lm_heads     // lm_head
         );
 
         if (bias) {
@@ -939,61 +1235,67 @@ static bool bark_model_load(std::ifstream & fin,
         }
     }
 
-    // allocate weights buffer
-    model.buffer_w = ggml_backend_alloc_ctx_tensors(model.ctx_w, model.backend);
-
-    // key + value memory
-    {
-        auto & ctx = model.ctx_kv;
+    // the weights only used by matrix products are repacked, so the decoding steps, which multiply
+    // them with a single token, run on the GEMV kernels; they are copied out of the mapping
+    ggml_backend_buffer_type_t buft_repack = bark_repack_buffer_type(model.backend);
 
-        // create the ggml context for key + value memory
-        {
-            struct ggml_init_params params = {
-                /*.mem_size   =*/ ggml_tensor_overhead() * n_tensors,
-                /*.mem_buffer =*/ NULL,
-                /*.no_alloc   =*/ true,
-            };
-
-            ctx = ggml_init(params);
-            if (!ctx) {
-                fprintf(stderr, "%s: ggml_init() failed\n", __func__);
-                return false;
+    if (buft_repack) {
+        std::vector<struct ggml_tensor *> repacked;
+        for (const auto & layer : model.layers) {
+            for (struct ggml_tensor * t : { layer.c_attn_attn_w, layer.c_attn_proj_w, layer.c_mlp_fc_w, layer.c_mlp_proj_w }) {
+                if (t->type == GGML_TYPE_Q4_0) {
+                    repacked.push_back(t);
+                }
+            }
+        }
+        for (struct ggml_tensor * t : model.lm_heads) {
+            if (t->type == GGML_TYPE_Q4_0) {
+                repacked.push_back(t);
             }
         }
 
-        const auto & hparams = model.hparams;
-
-        const int n_embd      = hparams.n_embd;
-        const int n_layer     = hparams.n_layer;
-        const int block_size  = hparams.block_size;
-
-        const int n_lm_heads  = hparams.n_lm_heads;
-        const int n_wtes      = hparams.n_wtes;
-
-        const int n_mem      = n_layer * block_size;
-        const int n_elements = n_embd * n_mem;
+        if (!repacked.empty()) {
+            const size_t alignment = ggml_backend_buft_get_alignment(buft_repack);
 
-        if (n_lm_heads == 1 && n_wtes == 1) {
-            // hack: if one LM head and one token embedding layer, we are loading weights
-            // of the text and coarse encoder. In this case, we need KV cache.
-            // for fine encoder, no need for KV cache, skip this part.
-            model.memory_k = ggml_new_tensor_1d(ctx, GGML_TYPE_F32, n_elements);
-            model.memory_v = ggml_new_tensor_1d(ctx, GGML_TYPE_F32, n_elements);
+            size_t size = 0;
+            for (struct ggml_tensor * t : repacked) {
+                size += GGML_PAD(ggml_backend_buft_get_alloc_size(buft_repack, t), alignment);
+            }
 
-            const size_t memory_size = ggml_nbytes(model.memory_k) + ggml_nbytes(model.memory_v);
+            model.buffer_repacked = ggml_backend_buft_alloc_buffer(buft_repack, size);
+            if (!model.buffer_repacked) {
+                fprintf(stderr, "%s: failed to allocate the repacked weights\n", __func__);
+                return false;
+            }
 
-            if (verbosity == bark_verbosity_level::HIGH) {
-                printf("%s: memory size = %8.2f MB, n_mem = %d\n", __func__, memory_size / 1024.0 / 1024.0, n_mem);
+            struct ggml_tallocr alloc = ggml_tallocr_new(model.buffer_repacked);
+            for (struct ggml_tensor * t : repacked) {
+                ggml_tallocr_alloc(&alloc, t);
             }
 
-            // allocate the KV memory in a backend buffer
-            model.buffer_kv = ggml_backend_alloc_ctx_tensors(ctx, model.backend);
+            if (verbosity == bark_verbosity_level::MEDIUM || verbosity == bark_verbosity_level::HIGH) {
+                printf("%s: repacked    = %8.2f MB\n", __func__, size / 1024.0 / 1024.0);
+            }
         }
     }
 
+    // use the weights in place when the model file is mapped and the weights stay in CPU memory,
+    // the others are allocated once all the tensors have been seen
+    const bool use_mapping = fin.addr && ggml_backend_is_cpu(model.backend);
+
+    if (use_mapping) {
+        model.buffer_mapped = ggml_backend_cpu_buffer_from_ptr((void *) fin.addr, fin.size);
+    } else {
+        model.buffer_w = ggml_backend_alloc_ctx_tensors(model.ctx_w, model.backend);
+    }
+
+    // tensors to copy from the mapping, with the offset of their data
+    std::vector<std::pair<struct ggml_tensor *, size_t>> copied;
+
     // load weights
     {
-        size_t total_size = 0;
+        size_t total_size  = 0;
+        size_t mapped_size = 0;
 
         std::vector<char> read_buf;
 
@@ -1023,6 +1325,9 @@ static bool bark_model_load(std::ifstream & fin,
             std::string name(length, 0);
             fin.read(&name[0], length);
 
+            // names may be padded with zeros to align the data
+            name.resize(strnlen(name.data(), length));
+
             if (model.tensors.find(name.data()) == model.tensors.end()) {
                 fprintf(stderr, "%s: unknown tensor '%s' in model file\n", __func__, name.data());
                 return false;
@@ -1050,7 +1355,22 @@ static bool bark_model_load(std::ifstream & fin,
                 return false;
             }
 
-            if (ggml_backend_buffer_is_host(model.buffer_w)) {
+            if (use_mapping) {
+                if (fin.pos + ggml_nbytes(tensor) > fin.size) {
+                    fprintf(stderr, "%s: tensor '%s' is truncated in model file\n", __func__, name.data());
+                    return false;
+                }
+
+                if (ttype == tensor->type && tensor->data == NULL && fin.pos % ggml_backend_buffer_get_alignment(model.buffer_mapped) == 0) {
+                    // in place in the mapped file
+                    ggml_backend_tensor_alloc(model.buffer_mapped, tensor, (void *) (fin.addr + fin.pos));
+                    mapped_size += ggml_nbytes(tensor);
+                } else {
+                    copied.push_back({ tensor, fin.pos });
+                }
+
+                fin.pos += ggml_nbytes(tensor);
+            } else if (ggml_backend_buffer_is_host(tensor->buffer)) {
                 // for the CPU and Metal backends, we can read directly into the device memory
                 fin.read(reinterpret_cast<char*>(tensor->data), ggml_nbytes(tensor));
             } else {
@@ -1067,8 +1387,29 @@ static bool bark_model_load(std::ifstream & fin,
             total_size += ggml_nbytes(tensor);
         }
 
+        // unaligned tensors, and any tensor not in the file, get their own buffer
+        bool all_mapped = true;
+        for (struct ggml_tensor * t = ggml_get_first_tensor(model.ctx_w); t; t = ggml_get_next_tensor(model.ctx_w, t)) {
+            all_mapped &= t->data != NULL;
+        }
+
+        if (!all_mapped) {
+            model.buffer_w = ggml_backend_alloc_ctx_tensors(model.ctx_w, model.backend);
+            if (!model.buffer_w) {
+                fprintf(stderr, "%s: failed to allocate the weights\n", __func__);
+                return false;
+            }
+        }
+
+        for (auto & c : copied) {
+            ggml_backend_tensor_set(c.first, fin.addr + c.second, 0, ggml_nbytes(c.first));
+        }
+
         if (verbosity == bark_verbosity_level::MEDIUM || verbosity == bark_verbosity_level::HIGH) {
             printf("%s: model size  = %8.2f MB\n", __func__, total_size / 1024.0 / 1024.0);
+            if (use_mapping) {
+                printf("%s: mapped      = %8.2f MB\n", __func__, mapped_size / 1024.0 / 1024.0);
+            }
         }
 
         model.memsize = total_size;
@@ -1078,15 +1419,19 @@ static bool bark_model_load(std::ifstream & fin,
 }
 
 static bool bark_load_model_from_file(
-    const std::string    & fname,
-    struct bark_context  * bctx,
-    bark_verbosity_level   verbosity) {
+    const std::string          & fname,
+    struct bark_context        * bctx,
+    struct bark_context_params & params) {
+    auto & verbosity = params.verbosity;
+
     if (verbosity == bark_verbosity_level::MEDIUM || verbosity == bark_verbosity_level::HIGH) {
         printf("%s: loading model from '%s'\n", __func__, fname.c_str());
     }
 
-    auto fin = std::ifstream(fname, std::ios::binary);
-    if (!fin) {
+    bctx->model_file.reset(new bark_model_file);
+
+    auto & fin = *bctx->model_file;
+    if (!fin.open(fname, params.use_mmap, params.mmap_prefetch)) {
         fprintf(stderr, "%s: failed to open '%s'\n", __func__, fname.c_str());
         return false;
     }
@@ -1145,23 +1490,40 @@ static bool bark_load_model_from_file(
 
     // codec model
     {
-        // not optimal: we close the file and reopen it using Encodec.cpp library with a
-        // specific offset
-        const int offset = fin.tellg();
-        fin.close();
+        // from the same mapping, or else the file is reopened by Encodec.cpp at the offset
+        const size_t offset = fin.tell();
+
+        if (fin.addr) {
+            bctx->encodec_ctx = encodec_load_model_from_memory(fin.addr, fin.size, offset, n_gpu_layers);
+        } else {
+            fin.fin.close();
+            bctx->encodec_ctx = encodec_load_model(fname.c_str(), offset, n_gpu_layers);
+        }
 
-        bctx->encodec_ctx = encodec_load_model(fname.c_str(), offset, n_gpu_layers);
         if (!bctx->encodec_ctx) {
             fprintf(stderr, "%s: invalid model file '%s' (bad encodec)\n", __func__, fname.c_str());
             return false;
         }
     }
 
+    // the graphs of the four models wait for the shared threadpool in the same lane
+    if (params.threadpool) {
+        for (gpt_model * model : { &bctx->text_model.semantic_model, &bctx->text_model.coarse_model, &bctx->text_model.fine_model }) {
+            if (ggml_backend_is_cpu(model->backend)) {
+                ggml_backend_cpu_set_threadpool(model->backend, params.threadpool);
+                ggml_backend_cpu_set_lane(model->backend, params.threadpool_lane);
+            }
+        }
+        encodec_set_threadpool(bctx->encodec_ctx, params.threadpool, params.threadpool_lane);
+    }
+
     printf("\n");
 
     return true;
 }
 
+static bool bark_init_compute(struct bark_context * bctx);
+
 struct bark_context* bark_load_model(const char* model_path, struct bark_context_params params, uint32_t seed) {
     ggml_time_init();
     int64_t t_load_start_us = ggml_time_us();
@@ -1171,23 +1533,85 @@ struct bark_context* bark_load_model(const char* model_path, struct bark_context
     bctx->text_model = bark_model();
 
     std::string model_path_str(model_path);
-    if (!bark_load_model_from_file(model_path_str, bctx, params.verbosity)) {
+    if (!bark_load_model_from_file(model_path_str, bctx, params)) {
         fprintf(stderr, "%s: failed to load model weights from '%s'\n", __func__, model_path);
         return nullptr;
     }
 
-    bctx->rng = std::mt19937(seed);
+    bctx->seed = seed;
+    bctx->rng  = std::mt19937(seed);
     bctx->params = params;
+
+    if (!bark_init_compute(bctx)) {
+        fprintf(stderr, "%s: failed to allocate the compute buffers\n", __func__);
+        return nullptr;
+    }
+
     bctx->stats.t_load_us = ggml_time_us() - t_load_start_us;
 
     return bctx;
 }
 
+void bark_set_seed(struct bark_context * bctx, uint32_t seed) {
+    bctx->seed = seed;
+    bctx->rng  = std::mt19937(seed);
+}
+
+// Store the key or value of the tokens being decoded in the KV cache, one token per
+// sequence at the position given by the n_past input, so the step graph does not depend
+// on n_past. K is stored by position [n_embd, n_ctx, n_seq], V is stored transposed
+// [n_ctx, n_embd, n_seq].
+static void bark_kv_store_k(
+        struct ggml_tensor       * dst,
+        const struct ggml_tensor * a,
+        const struct ggml_tensor * b,
+        const struct ggml_tensor * c,
+        int ith, int nth, void * userdata) {
+    for (int64_t s = 0; s < dst->ne[2]; s++) {
+        const int32_t n_past = ((const int32_t *) c->data)[s];
+        const float * src = (const float *) ((const char *) b->data + s * b->nb[1]);
+        void * row = (char *) dst->data + s * dst->nb[2] + n_past * dst->nb[1];
+
+        if (dst->type == GGML_TYPE_F32) {
+            memcpy(row, src, dst->ne[0] * sizeof(float));
+        } else {
+            ggml_get_type_traits_cpu(dst->type)->from_float(src, row, dst->ne[0]);
+        }
+    }
+}
+
+static void bark_kv_store_v(
+        struct ggml_tensor       * dst,
+        const struct ggml_tensor * a,
+        const struct ggml_tensor * b,
+        const struct ggml_tensor * c,
+        int ith, int nth, void * userdata) {
+    for (int64_t s = 0; s < dst->ne[2]; s++) {
+        const int32_t n_past = ((const int32_t *) c->data)[s];
+        const float * src = (const float *) ((const char *) b->data + s * b->nb[1]);
+
+        for (int64_t i = 0; i < dst->ne[1]; i++) {
+            char * dst_i = (char *) dst->data + s * dst->nb[2] + i * dst->nb[1] + n_past * dst->nb[0];
+            if (dst->type == GGML_TYPE_F32) {
+                *(float *) dst_i = src[i];
+            } else {
+                *(ggml_fp16_t *) dst_i = ggml_fp32_to_fp16(src[i]);
+            }
+        }
+    }
+}
+
+// Build the GPT graph for the tokens of the sequence in KV cache slot `slot`, after n_past
+// tokens. The step graph is for one token of each sequence in the first tokens.size()
+// slots: it reads n_past from an input and attends to the whole cache with a mask, so the
+// same graph serves every position and is built only once.
 static struct ggml_cgraph * bark_build_gpt_graph(
-          const gpt_model * model,
-          bark_sequence   & tokens,
-          int             * n_past,
-          bool              merge_ctx) {
+          gpt_model * model,
+      bark_sequence & tokens,
+                int * n_past,
+               bool   merge_ctx,
+               bool   step = false,
+                int   slot = 0) {
     if (!n_past) {
         fprintf(stderr, "%s: n_past is null\n", __func__);
         return NULL;
@@ -1204,8 +1628,23 @@ static struct ggml_cgraph * bark_build_gpt_graph(
     const int n_vocab = hparams.n_out_vocab;
     const int bias    = hparams.bias;
 
-    static size_t buf_size = ggml_tensor_overhead() * BARK_MAX_NODES + ggml_graph_overhead_custom(BARK_MAX_NODES, false);
-    static std::vector<uint8_t> buf(buf_size);
+    const int n_ctx_kv = model->n_ctx_kv;
+    const int n_seq_kv = model->n_seq_kv;
+
+    // the step graph has one token per sequence, the other graphs one sequence
+    const int n_seq = step ? N : 1;
+
+    const int head_dim = n_embd / n_head;
+
+    // bytes per position of K and V in the KV cache
+    const size_t row_k = ggml_row_size(model->memory_k->type, n_embd);
+    const size_t es_v  = ggml_element_size(model->memory_v);
+
+    const size_t buf_size = ggml_tensor_overhead() * BARK_MAX_NODES + ggml_graph_overhead_custom(BARK_MAX_NODES, false);
+
+    // the step graph outlives the next graph built
+    auto & buf = step ? model->buf_step : model->buf_graph;
+    buf.resize(buf_size);
 
     struct ggml_init_params ggml_params = {
         /*.mem_size   =*/ buf_size,
@@ -1223,8 +1662,8 @@ static struct ggml_cgraph * bark_build_gpt_graph(
 
     struct ggml_tensor * tok_emb;
 
-    if (*n_past > 0) {
-        assert(N == 1);
+    if (*n_past > 0 || step) {
+        assert(N == n_seq);
         tok_emb = ggml_get_rows(ctx0, model->wtes[0], input);
     } else {
         if (merge_ctx) {
@@ -1255,6 +1694,26 @@ static struct ggml_cgraph * bark_build_gpt_graph(
     ggml_set_input(position);
     ggml_set_name(position, "position");
 
+    // step inputs: position to store the KV at, and mask of the positions to attend to
+    struct ggml_tensor * past = NULL;
+    struct ggml_tensor * mask = NULL;
+
+    if (step) {
+        past = ggml_new_tensor_1d(ctx0, GGML_TYPE_I32, n_seq);
+        ggml_set_input(past);
+        ggml_set_name(past, "n_past");
+
+        mask = ggml_new_tensor_4d(ctx0, GGML_TYPE_F32, model->n_step_kv, 1, 1, n_seq);
+        ggml_set_input(mask);
+        ggml_set_name(mask, "mask");
+    }
+
+    // tokens of each sequence, after merging the context
+    const int n_tok = N / n_seq;
+
+    // number of positions attended to
+    const int n_kv = step ? model->n_step_kv : *n_past + N;
+
     // wte + wpe
     struct ggml_tensor * inpL = ggml_add(ctx0, tok_emb, ggml_get_rows(ctx0, model->wpe, position));
 
@@ -1290,47 +1749,70 @@ static struct ggml_cgraph * bark_build_gpt_graph(
             struct ggml_tensor* Kcur = ggml_view_2d(ctx0, cur, n_embd, N, cur->nb[1], 1 * sizeof(float) * n_embd);
             struct ggml_tensor* Vcur = ggml_view_2d(ctx0, cur, n_embd, N, cur->nb[1], 2 * sizeof(float) * n_embd);
 
+            // offsets of the layer and of the first sequence in the KV cache
+            const size_t offset_k = (il * n_seq_kv + slot) * n_ctx_kv * row_k;
+            const size_t offset_v = (il * n_seq_kv + slot) * n_ctx_kv * n_embd * es_v;
+
+            // layer of the KV cache, V is stored transposed so the attention reads it without a copy
+            struct ggml_tensor* k_l = ggml_view_3d(ctx0, model->memory_k, n_embd, n_ctx_kv, n_seq, row_k, n_ctx_kv * row_k, offset_k);
+            struct ggml_tensor* v_l = ggml_view_3d(ctx0, model->memory_v, n_ctx_kv, n_embd, n_seq, n_ctx_kv * es_v, n_ctx_kv * n_embd * es_v, offset_v);
+
             // store key and value to memory
-            if (N >= 1) {
-                struct ggml_tensor* k = ggml_view_1d(ctx0, model->memory_k, N * n_embd, (ggml_element_size(model->memory_k) * n_embd) * (il * n_ctx + *n_past));
-                struct ggml_tensor* v = ggml_view_1d(ctx0, model->memory_v, N * n_embd, (ggml_element_size(model->memory_v) * n_embd) * (il * n_ctx + *n_past));
+            if (step) {
+                k_l = ggml_map_custom3_inplace(ctx0, k_l, Kcur, past, bark_kv_store_k, 1, NULL);
+                v_l = ggml_map_custom3_inplace(ctx0, v_l, Vcur, past, bark_kv_store_v, 1, NULL);
+            } else {
+                struct ggml_tensor* k = ggml_view_1d(ctx0, model->memory_k, N * n_embd, offset_k + row_k * (*n_past));
+                struct ggml_tensor* v = ggml_view_2d(ctx0, model->memory_v, N, n_embd, n_ctx_kv * es_v, offset_v + es_v * (*n_past));
+
+                // quantizing needs contiguous rows
+                if (ggml_is_quantized(k->type)) {
+                    Kcur = ggml_cont(ctx0, Kcur);
+                }
 
                 ggml_build_forward_expand(gf, ggml_cpy(ctx0, Kcur, k));
-                ggml_build_forward_expand(gf, ggml_cpy(ctx0, Vcur, v));
+                ggml_build_forward_expand(gf, ggml_cpy(ctx0, ggml_transpose(ctx0, Vcur), v));
             }
 
             struct ggml_tensor* Q =
                 ggml_permute(ctx0,
                              ggml_cpy(ctx0,
                                       Qcur,
-                                      ggml_new_tensor_3d(ctx0, GGML_TYPE_F32, n_embd / n_head, n_head, N)),
+                                      ggml_new_tensor_4d(ctx0, GGML_TYPE_F32, head_dim, n_head, n_tok, n_seq)),
                              0, 2, 1, 3);
 
             struct ggml_tensor* K =
                 ggml_permute(ctx0,
-                             ggml_reshape_3d(ctx0,
-                                             ggml_view_1d(ctx0, model->memory_k, (*n_past + N) * n_embd, il * n_ctx * ggml_element_size(model->memory_k) * n_embd),
-                                             n_embd / n_head, n_head, *n_past + N),
+                             ggml_view_4d(ctx0, k_l,
+                                          head_dim, n_head, n_kv, n_seq,
+                                          ggml_row_size(k_l->type, head_dim), k_l->nb[1], k_l->nb[2],
+                                          0),
                              0, 2, 1, 3);
 
             struct ggml_tensor* KQ = ggml_mul_mat(ctx0, K, Q);
 
-            struct ggml_tensor* KQ_scaled = ggml_scale_inplace(ctx0, KQ, 1.0f/sqrtf(float(n_embd)/n_head));
+            struct ggml_tensor* KQ_soft_max;
+
+            if (step) {
+                // the mask of each sequence applies to all its heads
+                struct ggml_tensor* KQ_masked = ggml_add(ctx0, KQ, mask);
 
-            struct ggml_tensor* KQ_masked = ggml_diag_mask_inf_inplace(ctx0, KQ_scaled, *n_past);
+                KQ_soft_max = ggml_soft_max_ext(ctx0, KQ_masked, NULL, 1.0f/sqrtf(float(n_embd)/n_head), 0.0f);
+            } else {
+                struct ggml_tensor* KQ_scaled = ggml_scale_inplace(ctx0, KQ, 1.0f/sqrtf(float(n_embd)/n_head));
 
-            struct ggml_tensor* KQ_soft_max = ggml_soft_max_inplace(ctx0, KQ_masked);
+                struct ggml_tensor* KQ_masked = ggml_diag_mask_inf_inplace(ctx0, KQ_scaled, *n_past);
 
-            struct ggml_tensor* V_trans =
-                ggml_cpy(ctx0,
-                         ggml_permute(ctx0,
-                                      ggml_reshape_3d(ctx0,
-                                                      ggml_view_1d(ctx0, model->memory_v, (*n_past + N) * n_embd, il * n_ctx * ggml_element_size(model->memory_v) * n_embd),
-                                                      n_embd / n_head, n_head, *n_past + N),
-                                      1, 2, 0, 3),
-                         ggml_new_tensor_3d(ctx0, model->memory_v->type, *n_past + N, n_embd / n_head, n_head));
+                KQ_soft_max = ggml_soft_max_inplace(ctx0, KQ_masked);
+            }
 
-            struct ggml_tensor* KQV = ggml_mul_mat(ctx0, V_trans, KQ_soft_max);
+            struct ggml_tensor* V =
+                ggml_view_4d(ctx0, v_l,
+                             n_kv, head_dim, n_head, n_seq,
+                             v_l->nb[1], v_l->nb[1] * head_dim, v_l->nb[2],
+                             0);
+
+            struct ggml_tensor* KQV = ggml_mul_mat(ctx0, V, KQ_soft_max);
 
             struct ggml_tensor* KQV_merged = ggml_permute(ctx0, KQV, 0, 2, 1, 3);
 
@@ -1400,9 +1882,12 @@ static struct ggml_cgraph * bark_build_gpt_graph(
         }
     }
 
-    inpL = ggml_mul_mat(ctx0,
-                        model->lm_heads[0],
-                        ggml_view_1d(ctx0, inpL, inpL->ne[0], (inpL->ne[1] - 1) * inpL->nb[1]));
+    // logits of the last token, or of the token of each sequence
+    if (!step) {
+        inpL = ggml_view_1d(ctx0, inpL, inpL->ne[0], (inpL->ne[1] - 1) * inpL->nb[1]);
+    }
+
+    inpL = ggml_mul_mat(ctx0, model->lm_heads[0], inpL);
     ggml_set_name(inpL, "logits");
     ggml_set_output(inpL);
 
@@ -1414,7 +1899,7 @@ static struct ggml_cgraph * bark_build_gpt_graph(
 }
 
 static ggml_cgraph * bark_build_fine_gpt_graph(
-    const gpt_model * model,
+          gpt_model * model,
     bark_sequence   & tokens,
     int               codebook_idx,
     int               n_fine_codebooks) {
@@ -1434,8 +1919,10 @@ static ggml_cgraph * bark_build_fine_gpt_graph(
     assert(N <= n_ctx);
     assert(codebook_idx > 0);
 
-    static size_t buf_size = ggml_tensor_overhead() * BARK_MAX_NODES + ggml_graph_overhead_custom(BARK_MAX_NODES, false);
-    static std::vector<uint8_t> buf(buf_size);
+    const size_t buf_size = ggml_tensor_overhead() * BARK_MAX_NODES + ggml_graph_overhead_custom(BARK_MAX_NODES, false);
+
+    auto & buf = model->buf_graph;
+    buf.resize(buf_size);
 
     struct ggml_init_params ggml_params = {
         /*.mem_size   =*/ buf_size,
@@ -1583,24 +2070,240 @@ static ggml_cgraph * bark_build_fine_gpt_graph(
     return gf;
 }
 
-static bool bark_eval_encoder_internal(
-    gpt_model          & model,
-    ggml_gallocr_t       allocr,
-    bark_sequence      & input_sequence,
-    std::vector<float> & logits,
-    int                * n_past,
-    bool                 merge_ctx,
-    int                  n_threads) {
-    auto & hparams = model.hparams;
-    const int n_vocab = hparams.n_out_vocab;
-    int N = input_sequence.size();
+// Allocate the KV cache of a GPT model for n_seq sequences of n_ctx positions
+static bool bark_init_kv_cache(
+    gpt_model            & model,
+    int                    n_ctx,
+    int                    n_seq,
+    enum ggml_type         type_k,
+    enum ggml_type         type_v,
+    bark_verbosity_level   verbosity) {
+    const auto & hparams = model.hparams;
 
-    const int64_t t_predict_us_start = ggml_time_us();
+    const int n_embd  = hparams.n_embd;
+    const int n_layer = hparams.n_layer;
+    const int n_head  = hparams.n_head;
+
+    // K is quantized by head, V is written one position at a time across its transposed rows
+    if (type_k != GGML_TYPE_F32 && type_k != GGML_TYPE_F16 && type_k != GGML_TYPE_Q8_0) {
+        fprintf(stderr, "%s: unsupported KV cache key type %s\n", __func__, ggml_type_name(type_k));
+        return false;
+    }
+    if (type_v != GGML_TYPE_F32 && type_v != GGML_TYPE_F16) {
+        fprintf(stderr, "%s: unsupported KV cache value type %s\n", __func__, ggml_type_name(type_v));
+        return false;
+    }
+    if ((n_embd / n_head) % ggml_blck_size(type_k) != 0) {
+        fprintf(stderr, "%s: head size %d is not a multiple of the %s block size\n", __func__, n_embd / n_head, ggml_type_name(type_k));
+        return false;
+    }
 
-    struct ggml_cgraph * gf = bark_build_gpt_graph(&model, input_sequence, n_past, merge_ctx);
+    auto & ctx = model.ctx_kv;
 
-    // allocate the graph tensors
-    ggml_gallocr_alloc_graph(allocr, gf);
+    // create the ggml context for key + value memory
+    {
+        struct ggml_init_params params = {
+            /*.mem_size   =*/ ggml_tensor_overhead() * 2,
+            /*.mem_buffer =*/ NULL,
+            /*.no_alloc   =*/ true,
+        };
+
+        ctx = ggml_init(params);
+        if (!ctx) {
+            fprintf(stderr, "%s: ggml_init() failed\n", __func__);
+            return false;
+        }
+    }
+
+    const int n_mem      = n_layer * n_ctx * n_seq;
+    const int n_elements = n_embd * n_mem;
+
+    model.n_ctx_kv = n_ctx;
+    model.n_seq_kv = n_seq;
+    model.memory_k = ggml_new_tensor_1d(ctx, type_k, n_elements);
+    model.memory_v = ggml_new_tensor_1d(ctx, type_v, n_elements);
+
+    const size_t memory_size = ggml_nbytes(model.memory_k) + ggml_nbytes(model.memory_v);
+
+    if (verbosity == bark_verbosity_level::HIGH) {
+        printf("%s: memory size = %8.2f MB, n_mem = %d\n", __func__, memory_size / 1024.0 / 1024.0, n_mem);
+    }
+
+    // allocate the KV memory in a backend buffer
+    model.buffer_kv = ggml_backend_alloc_ctx_tensors(ctx, model.backend);
+    if (!model.buffer_kv) {
+        return false;
+    }
+
+    // the step graph attends to blocks of positions, masked positions must hold finite values
+    ggml_backend_buffer_clear(model.buffer_kv, 0);
+
+    return true;
+}
+
+// Grow the KV cache of a GPT model to n_ctx positions for each of its sequences, rounded up to
+// blocks of BARK_KV_BLOCK and at most the block size. Growing discards the cache and the step
+// graph viewing it, so it is only called before the prompts of a generation.
+static bool bark_grow_kv_cache(
+    gpt_model                 & model,
+    int                         n_ctx,
+    const bark_context_params & params) {
+    n_ctx = std::min(model.hparams.block_size, GGML_PAD(n_ctx, BARK_KV_BLOCK));
+    if (n_ctx <= model.n_ctx_kv) {
+        return true;
+    }
+
+    const enum ggml_type type_k = model.memory_k->type;
+    const enum ggml_type type_v = model.memory_v->type;
+
+    ggml_backend_buffer_free(model.buffer_kv);
+    ggml_free(model.ctx_kv);
+    model.buffer_kv = NULL;
+    model.ctx_kv    = NULL;
+
+    if (!bark_init_kv_cache(model, n_ctx, model.n_seq_kv, type_k, type_v, params.verbosity)) {
+        fprintf(stderr, "%s: failed to grow the KV cache to %d positions\n", __func__, n_ctx);
+        return false;
+    }
+
+    model.gf_step    = NULL;
+    model.n_step_seq = 0;
+    model.n_step_kv  = 0;
+
+    return true;
+}
+
+// Reserve the compute buffer for the prompt graph gf and, with a KV cache on the CPU, for the step
+// graph attending to n_kv positions. Both buffers grow when longer prompts arrive.
+static bool bark_reserve_compute(
+    gpt_model            & model,
+    struct ggml_cgraph   * gf,
+    int                    n_kv,
+    bark_verbosity_level   verbosity) {
+    model.allocr = ggml_gallocr_new(ggml_backend_get_default_buffer_type(model.backend));
+
+    // pre-allocate the compute buffer for the prompt graph
+    if (!ggml_gallocr_reserve(model.allocr, gf)) {
+        return false;
+    }
+
+    if (verbosity == bark_verbosity_level::MEDIUM || verbosity == bark_verbosity_level::HIGH) {
+        size_t mem_size = ggml_gallocr_get_buffer_size(model.allocr, 0);
+        fprintf(stderr, "%s: compute buffer size: %.2f MB\n\n", __func__, mem_size / 1024.0 / 1024.0);
+    }
+
+    // build and allocate the single sequence step graph, the KV store is a CPU op, for the
+    // positions predicted at load, the buffer grows when the graph is rebuilt for more
+    if (model.memory_k && ggml_backend_is_cpu(model.backend)) {
+        model.allocr_step = ggml_gallocr_new(ggml_backend_get_default_buffer_type(model.backend));
+
+        int n_past = 0;
+        bark_sequence token(1, 0);
+        model.n_step_kv  = std::min(model.n_ctx_kv, GGML_PAD(n_kv, BARK_KV_BLOCK));
+        model.gf_step    = bark_build_gpt_graph(&model, token, &n_past, false, true /* step */);
+        model.n_step_seq = 1;
+
+        if (!ggml_gallocr_alloc_graph(model.allocr_step, model.gf_step)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// Allocate the KV caches and compute buffers of the encoders for the lifetime of the context
+static bool bark_init_compute(struct bark_context * bctx) {
+    auto & params    = bctx->params;
+    auto & verbosity = params.verbosity;
+
+    // semantic: prompt with the merged text and semantic history
+    {
+        auto & model = bctx->text_model.semantic_model;
+
+        // merged prompt, then one position per semantic token, the cache grows with the token
+        // budget of the prompts
+        const int n_ctx = std::min(model.hparams.block_size, GGML_PAD(256 + 1 + 1, BARK_KV_BLOCK));
+
+        if (!bark_init_kv_cache(model, n_ctx, params.n_batch, params.type_k, params.type_v, verbosity)) {
+            return false;
+        }
+
+        int n_past = 0;
+        std::vector<bark_vocab::id> decoy_tokens(256 + 256 + 1, 0);
+        struct ggml_cgraph * gf = bark_build_gpt_graph(&model, decoy_tokens, &n_past, true /* merge_ctx */);
+
+        // merged prompt and the first semantic token
+        if (!bark_reserve_compute(model, gf, 256 + 1 + 1, verbosity)) {
+            return false;
+        }
+    }
+
+    // coarse: semantic history, infer token, coarse history and the window being sampled
+    {
+        auto & model = bctx->text_model.coarse_model;
+
+        // first window, the cache grows with the coarse history of longer texts
+        const int n_ctx = std::min(model.hparams.block_size, GGML_PAD(256 + 1 + params.sliding_window_size, BARK_KV_BLOCK));
+
+        if (!bark_init_kv_cache(model, n_ctx, params.n_batch, params.type_k, params.type_v, verbosity)) {
+            return false;
+        }
+
+        int n_past = 0;
+        std::vector<bark_vocab::id> decoy_tokens(n_ctx, 0);
+        struct ggml_cgraph * gf = bark_build_gpt_graph(&model, decoy_tokens, &n_past, false /* merge_ctx */);
+
+        // prompt of the first window and its first coarse token
+        if (!bark_reserve_compute(model, gf, 256 + 1 + 1, verbosity)) {
+            return false;
+        }
+    }
+
+    // fine: full block of all codebooks
+    {
+        auto & model = bctx->text_model.fine_model;
+
+        const int n_fine_codebooks = bctx->params.n_fine_codebooks;
+
+        std::vector<bark_vocab::id> decoy_tokens(model.hparams.block_size * n_fine_codebooks, 0);
+        struct ggml_cgraph * gf = bark_build_fine_gpt_graph(&model, decoy_tokens, 2 /* codebook_idx */, n_fine_codebooks);
+
+        if (!bark_reserve_compute(model, gf, 0, verbosity)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+static bool bark_eval_encoder_internal(
+    gpt_model          & model,
+    bark_sequence      & input_sequence,
+    std::vector<float> & logits,
+    int                * n_past,
+    bool                 merge_ctx,
+    int                  n_threads,
+    int                  slot = 0) {
+    auto & hparams = model.hparams;
+    const int n_vocab = hparams.n_out_vocab;
+    int N = input_sequence.size();
+
+    const int64_t t_predict_us_start = ggml_time_us();
+
+    // the merged context only takes 256 + 1 positions
+    const int n_new = (*n_past == 0 && merge_ctx) ? N - 256 : N;
+    if (*n_past + n_new > model.n_ctx_kv) {
+        fprintf(stderr, "%s: KV cache is full (%d positions)\n", __func__, model.n_ctx_kv);
+        return false;
+    }
+
+    struct ggml_cgraph * gf = bark_build_gpt_graph(&model, input_sequence, n_past, merge_ctx, false, slot);
+
+    // allocate the graph tensors, the compute buffer grows for longer prompts
+    if (!ggml_gallocr_alloc_graph(model.allocr, gf)) {
+        fprintf(stderr, "%s: failed to allocate the graph\n", __func__);
+        return false;
+    }
 
     // set the graph inputs
     struct ggml_tensor * input = ggml_graph_get_tensor(gf, "input");
@@ -1642,10 +2345,163 @@ static bool bark_eval_encoder_internal(
     return true;
 }
 
-static bool bark_eval_text_encoder(struct bark_context * bctx, int n_threads) {
-    bark_sequence input = bctx->tokens;
-    bark_sequence output;
+// Decode one token for each sequence, the sequence in KV cache slot s continues with
+// tokens[s] after n_past[s] tokens. The logits of sequence s are at s * n_vocab.
+static bool bark_eval_encoder_step(
+    gpt_model          & model,
+    bark_sequence      & tokens,
+    std::vector<int>   & n_past,
+    std::vector<float> & logits,
+    int                  n_threads) {
+    const int n_vocab = model.hparams.n_out_vocab;
+    const int n_seq   = tokens.size();
+
+    logits.resize(n_vocab * n_seq);
+
+    // without the step graph, build a graph for each sequence
+    if (!model.allocr_step) {
+        std::vector<float> logits_seq;
+
+        for (int s = 0; s < n_seq; s++) {
+            bark_sequence token(1, tokens[s]);
+            if (!bark_eval_encoder_internal(model, token, logits_seq, &n_past[s], false, n_threads, s)) {
+                return false;
+            }
+            std::copy(logits_seq.begin(), logits_seq.end(), logits.begin() + s * n_vocab);
+        }
+
+        return true;
+    }
+
+    const int64_t t_predict_us_start = ggml_time_us();
+
+    int n_kv = 0;
+    for (int s = 0; s < n_seq; s++) {
+        if (n_past[s] + 1 > model.n_ctx_kv) {
+            fprintf(stderr, "%s: KV cache is full (%d positions)\n", __func__, model.n_ctx_kv);
+            return false;
+        }
+        n_kv = std::max(n_kv, n_past[s] + 1);
+    }
+
+    // attend to the positions in use, in blocks so the graph is rarely rebuilt
+    n_kv = std::min(model.n_ctx_kv, GGML_PAD(n_kv, BARK_KV_BLOCK));
+
+    // the step graph is rebuilt only when the number of sequences or positions changes
+    if (model.n_step_seq != n_seq || model.n_step_kv != n_kv) {
+        int n_past_graph = 0;
+        model.n_step_kv  = n_kv;
+        model.gf_step    = bark_build_gpt_graph(&model, tokens, &n_past_graph, false, true /* step */);
+        model.n_step_seq = n_seq;
+
+        if (!ggml_gallocr_alloc_graph(model.allocr_step, model.gf_step)) {
+            fprintf(stderr, "%s: failed to allocate the step graph\n", __func__);
+            return false;
+        }
+    }
+
+    struct ggml_cgraph * gf = model.gf_step;
+
+    // set the graph inputs
+    struct ggml_tensor * input = ggml_graph_get_tensor(gf, "input");
+    ggml_backend_tensor_set(input, tokens.data(), 0, n_seq * ggml_element_size(input));
+
+    std::vector<int32_t> pos(n_past.begin(), n_past.end());
+
+    struct ggml_tensor * position = ggml_graph_get_tensor(gf, "position");
+    ggml_backend_tensor_set(position, pos.data(), 0, n_seq * sizeof(int32_t));
+
+    struct ggml_tensor * past = ggml_graph_get_tensor(gf, "n_past");
+    ggml_backend_tensor_set(past, pos.data(), 0, n_seq * sizeof(int32_t));
+
+    // each sequence attends to its positions up to and including the new token
+    struct ggml_tensor * mask = ggml_graph_get_tensor(gf, "mask");
+
+    std::vector<float> mask_data(n_kv * n_seq, -INFINITY);
+    for (int s = 0; s < n_seq; s++) {
+        std::fill(mask_data.begin() + s * n_kv, mask_data.begin() + s * n_kv + n_past[s] + 1, 0.0f);
+    }
+    ggml_backend_tensor_set(mask, mask_data.data(), 0, ggml_nbytes(mask));
+
+    ggml_backend_cpu_set_n_threads(model.backend, n_threads);
+
+    // run the computation
+    ggml_backend_graph_compute(model.backend, gf);
+
+    struct ggml_tensor * inpL = ggml_graph_get_tensor(gf, "logits");
+    ggml_backend_tensor_get(inpL, logits.data(), 0, sizeof(float) * n_vocab * n_seq);
+
+    for (int s = 0; s < n_seq; s++) {
+        n_past[s] += 1;
+    }
+
+    model.t_predict_us += ggml_time_us() - t_predict_us_start;
+
+    return true;
+}
+
+// Move the first n_past positions of the KV cache from slot src to slot dst.
+static void bark_kv_move_slot(gpt_model & model, int src, int dst, int n_past) {
+    const int n_embd   = model.hparams.n_embd;
+    const int n_layer  = model.hparams.n_layer;
+    const int n_ctx_kv = model.n_ctx_kv;
+    const int n_seq_kv = model.n_seq_kv;
+
+    const size_t row_k = ggml_row_size(model.memory_k->type, n_embd);
+    const size_t es_v  = ggml_element_size(model.memory_v);
 
+    std::vector<uint8_t> tmp(std::max(n_past * row_k, n_past * es_v));
+
+    for (int il = 0; il < n_layer; il++) {
+        // K is stored by position, the positions of a slot are contiguous
+        const size_t offset_k_src = (size_t) (il * n_seq_kv + src) * n_ctx_kv * row_k;
+        const size_t offset_k_dst = (size_t) (il * n_seq_kv + dst) * n_ctx_kv * row_k;
+
+        ggml_backend_tensor_get(model.memory_k, tmp.data(), offset_k_src, n_past * row_k);
+        ggml_backend_tensor_set(model.memory_k, tmp.data(), offset_k_dst, n_past * row_k);
+
+        // V is stored transposed, the positions are contiguous in each of the n_embd rows
+        const size_t offset_v_src = (size_t) (il * n_seq_kv + src) * n_ctx_kv * n_embd * es_v;
+        const size_t offset_v_dst = (size_t) (il * n_seq_kv + dst) * n_ctx_kv * n_embd * es_v;
+
+        for (int i = 0; i < n_embd; i++) {
+            ggml_backend_tensor_get(model.memory_v, tmp.data(), offset_v_src + i * n_ctx_kv * es_v, n_past * es_v);
+            ggml_backend_tensor_set(model.memory_v, tmp.data(), offset_v_dst + i * n_ctx_kv * es_v, n_past * es_v);
+        }
+    }
+}
+
+// Drop the sequence in KV cache slot k from the batch, the sequence of the last slot moves
+// into slot k so the step graph keeps decoding the first slots only.
+static void bark_kv_drop_slot(
+    gpt_model        & model,
+    std::vector<int> & slot_seq,
+    bark_sequence    & input,
+    std::vector<int> & n_past,
+    int                k) {
+    const int last = slot_seq.size() - 1;
+
+    if (k != last) {
+        bark_kv_move_slot(model, last, k, n_past[last]);
+
+        slot_seq[k] = slot_seq[last];
+        input[k]    = input[last];
+        n_past[k]   = n_past[last];
+    }
+
+    slot_seq.pop_back();
+    input.pop_back();
+    n_past.pop_back();
+}
+
+// Generate the semantic tokens of the prompts together, each with its own generator. Prompt
+// s starts in KV cache slot s, and the finished prompts are dropped from the batch.
+static bool bark_eval_text_encoder(
+    struct bark_context               * bctx,
+    const std::vector<bark_sequence>  & prompts,
+    const std::vector<std::mt19937 *> & rngs,
+    std::vector<bark_sequence>        & semantic,
+    int                                 n_threads) {
     auto & params = bctx->params;
 
     int32_t n_steps_text_encoder = params.n_steps_text_encoder;
@@ -1653,48 +2509,136 @@ static bool bark_eval_text_encoder(struct bark_context * bctx, int n_threads) {
     int32_t semantic_pad_token   = params.semantic_pad_token;
 
     auto & model   = bctx->text_model.semantic_model;
-    auto & allocr  = bctx->allocr;
     auto & hparams = model.hparams;
 
     const int n_vocab = hparams.n_out_vocab;
+    const int n_seq   = prompts.size();
     float min_eos_p   = bctx->params.min_eos_p;
     float temp        = bctx->params.temp;
 
     std::vector<float> logits;
-    logits.resize(n_vocab);
+    std::vector<float> logits_seq;
+
+    // sequence decoded in each KV cache slot, with its last token and positions
+    std::vector<int> slot_seq(n_seq);
+    std::iota(slot_seq.begin(), slot_seq.end(), 0);
 
-    float eos_p = 0;
-    int n_past  = 0;
+    std::vector<int> n_past(n_seq, 0);
+    bark_sequence input(n_seq, 0);
 
-    for (int i = 0; i < n_steps_text_encoder; i++) {
+    std::vector<bool> done(n_seq, false);
+
+    // budget of semantic tokens predicted from the length of each prompt
+    std::vector<int> n_steps(n_seq, n_steps_text_encoder);
+
+    if (params.text_rate_hz > 0) {
+        for (int s = 0; s < n_seq; s++) {
+            int n_text = 0;
+            for (int j = 0; j < 256; j++) {
+                if (prompts[s][j] != params.text_pad_token) {
+                    n_text++;
+                }
+            }
+
+            // at least a second, and a second for each text_rate_hz tokens
+            const float duration = 1.0f + n_text / params.text_rate_hz;
+            n_steps[s] = std::min(n_steps_text_encoder, (int) ceilf(duration * params.semantic_rate_hz));
+        }
+    }
+
+    const int n_steps_max = *std::max_element(n_steps.begin(), n_steps.end());
+
+    // merged prompt, then one position per semantic token
+    if (!bark_grow_kv_cache(model, 256 + 1 + n_steps_max, params)) {
+        return false;
+    }
+
+    // probability of EOS at the previous step and number of steps it rose in a row
+    std::vector<float> prev_eos_p(n_seq, 0.0f);
+    std::vector<int> n_eos_rise(n_seq, 0);
+
+    semantic.assign(n_seq, bark_sequence());
+
+    for (int i = 0; i < n_steps_max; i++) {
         if (params.progress_callback) {
-            const int progress_cur = 100 * (i + 1) / n_steps_text_encoder;
+            const int progress_cur = 100 * (i + 1) / n_steps_max;
 
             params.progress_callback(
                 bctx, bark_encoding_step::SEMANTIC, progress_cur, params.progress_callback_user_data);
         }
 
-        if (!bark_eval_encoder_internal(model, allocr, input, logits, &n_past, true, n_threads)) {
-            fprintf(stderr, "%s: Could not generate token\n", __func__);
-            return false;
+        if (i == 0) {
+            // prompts, one sequence at a time
+            logits.resize(n_vocab * n_seq);
+
+            for (int s = 0; s < n_seq; s++) {
+                bark_sequence prompt = prompts[s];
+                if (!bark_eval_encoder_internal(model, prompt, logits_seq, &n_past[s], true, n_threads, s)) {
+                    fprintf(stderr, "%s: Could not generate token\n", __func__);
+                    return false;
+                }
+                std::copy(logits_seq.begin(), logits_seq.end(), logits.begin() + s * n_vocab);
+            }
+        } else {
+            if (!bark_eval_encoder_step(model, input, n_past, logits, n_threads)) {
+                fprintf(stderr, "%s: Could not generate token\n", __func__);
+                return false;
+            }
         }
 
-        std::vector<float> relevant_logits(logits.begin(), logits.begin() + semantic_vocab_size);
-        relevant_logits.push_back(logits[semantic_pad_token]);
+        for (int k = 0; k < (int) slot_seq.size(); k++) {
+            const int s = slot_seq[k];
 
-        input.clear();
+            float * logits_s = logits.data() + k * n_vocab;
 
-        bark_token next = gpt_sample(
-            logits, bctx->rng, temp, &eos_p, &model.t_sample_us, &model.n_sample);
+            // relevant logits: the semantic tokens followed by the pad token
+            logits_s[semantic_vocab_size] = logits_s[semantic_pad_token];
 
-        if (next == semantic_vocab_size || eos_p >= min_eos_p)
-            break;
+            float eos_p = 0;
+
+            bark_token next = gpt_sample(
+                bctx, model, *rngs[s], logits_s, semantic_vocab_size + 1, temp, params.top_k, params.top_p, &eos_p);
+
+            // EOS likely, or getting likely for the last eos_patience steps
+            n_eos_rise[s] = eos_p > prev_eos_p[s] ? n_eos_rise[s] + 1 : 0;
+            prev_eos_p[s] = eos_p;
 
-        input.push_back(next);
-        output.push_back(next);
+            const bool eos_rising = params.eos_patience > 0 && n_eos_rise[s] >= params.eos_patience && eos_p >= 0.5f * min_eos_p;
+
+            const bool eos = next == semantic_vocab_size || eos_p >= min_eos_p || eos_rising;
+
+            if (eos && !semantic[s].empty()) {
+                done[s] = true;
+                continue;
+            }
+
+            // the coarse encoder needs at least one frame: a sequence stopping on its first
+            // step continues with its most likely semantic token, and stops after it
+            if (eos) {
+                next = std::max_element(logits_s, logits_s + semantic_vocab_size) - logits_s;
+                done[s] = true;
+            }
+
+            input[k] = next;
+            semantic[s].push_back(next);
+
+            // out of budget
+            if ((int) semantic[s].size() >= n_steps[s]) {
+                done[s] = true;
+            }
+        }
+
+        // the finished sequences leave the batch, from the last slot so the moved ones are active
+        for (int k = slot_seq.size() - 1; k >= 0; k--) {
+            if (done[slot_seq[k]]) {
+                bark_kv_drop_slot(model, slot_seq, input, n_past, k);
+            }
+        }
+
+        if (slot_seq.empty())
+            break;
     }
 
-    bctx->semantic_tokens         = output;
     bctx->stats.n_sample_semantic = model.n_sample;
 
     return true;
@@ -1703,60 +2647,48 @@ static bool bark_eval_text_encoder(struct bark_context * bctx, int n_threads) {
 bool bark_forward_text_encoder(struct bark_context * bctx, int n_threads) {
     const int64_t t_main_start_us = ggml_time_us();
 
-    auto & model     = bctx->text_model.semantic_model;
-    auto & allocr    = bctx->allocr;
-    auto & hparams   = model.hparams;
-    auto & verbosity = bctx->params.verbosity;
-
-    // allocate the compute buffer
-    {
-        bctx->allocr = ggml_gallocr_new(ggml_backend_get_default_buffer_type(model.backend));
+    auto & model = bctx->text_model.semantic_model;
 
-        // create the worst-case graph for memory usage estimation
-        int n_past = 0;
-        std::vector<bark_vocab::id> decoy_tokens(256 + 256 + 1, 0);
-        struct ggml_cgraph * gf = bark_build_gpt_graph(&model, decoy_tokens, &n_past, true /* merge_ctx */);
+    std::vector<bark_sequence> semantic;
 
-        // pre-allocate the compute buffer for the worst case
-        ggml_gallocr_reserve(allocr, gf);
-        size_t mem_size =  ggml_gallocr_get_buffer_size(allocr, 0);
-
-        if (verbosity == bark_verbosity_level::MEDIUM || verbosity == bark_verbosity_level::HIGH) {
-            fprintf(stderr, "%s: compute buffer size: %.2f MB\n\n", __func__, mem_size / 1024.0 / 1024.0);
-        }
-    }
-
-    if (!bark_eval_text_encoder(bctx, n_threads)) {
+    if (!bark_eval_text_encoder(bctx, { bctx->tokens }, { &bctx->rng }, semantic, n_threads)) {
         fprintf(stderr, "%s: failed to forward text encoder\n", __func__);
         return false;
     }
 
+    bctx->semantic_tokens = semantic[0];
+
     model.t_main_us = ggml_time_us() - t_main_start_us;
     bctx->stats.t_semantic_us = model.t_main_us;
 
     bark_print_statistics(&model);
 
-    ggml_gallocr_free(bctx->allocr);
-    ggml_backend_buffer_free(bctx->buf_compute);
-
     return true;
 }
 
-static bool bark_eval_coarse_encoder(struct bark_context * bctx, int n_threads) {
-    bark_codes out_coarse;
-    bark_sequence out;
-
-    bark_sequence input = bctx->semantic_tokens;
-
+static bool bark_stream_decode(
+    struct bark_context * bctx,
+    struct bark_stream  * stream,
+    const bark_sequence & coarse,
+    int                   n_threads);
+
+// Generate the coarse tokens of the semantic sequences together, each with its own generator.
+// The windows of all the sequences start at the same steps, the unfinished sequences take
+// the first KV cache slots at the start of each window and leave the batch once finished.
+// The stream, if any, decodes the audio of the first sequence after each window.
+static bool bark_eval_coarse_encoder(
+    struct bark_context               * bctx,
+    const std::vector<bark_sequence>  & semantic,
+    const std::vector<std::mt19937 *> & rngs,
+    std::vector<bark_codes>           & coarse,
+    struct bark_stream                * stream,
+    int                                 n_threads) {
     auto & model   = bctx->text_model.coarse_model;
-    auto & allocr  = bctx->allocr;
     auto & hparams = model.hparams;
     auto & params  = bctx->params;
 
     const int n_vocab = hparams.n_out_vocab;
-
-    std::vector<float> logits;
-    logits.resize(n_vocab);
+    const int n_seq   = semantic.size();
 
     int max_coarse_history  = params.max_coarse_history;
     int sliding_window_size = params.sliding_window_size;
@@ -1776,131 +2708,187 @@ static bool bark_eval_coarse_encoder(struct bark_context * bctx, int n_threads)
 
     int max_semantic_history = floorf(max_coarse_history / stc_ratio);
 
-    int n_steps = floorf(input.size() * stc_ratio / n_coarse_codebooks) * n_coarse_codebooks;
-    assert(n_steps > 0);
-    assert(n_steps % n_coarse_codebooks == 0);
+    std::vector<int> n_steps(n_seq);
 
-    int n_window_steps = ceilf(static_cast<float>(n_steps) / sliding_window_size);
+    int n_steps_total  = 0;
+    int n_window_steps = 0;
 
-    int step_idx = 0;
+    for (int s = 0; s < n_seq; s++) {
+        n_steps[s] = floorf(semantic[s].size() * stc_ratio / n_coarse_codebooks) * n_coarse_codebooks;
+        if (n_steps[s] <= 0) {
+            fprintf(stderr, "%s: no semantic tokens to generate coarse tokens from for text %d\n", __func__, s);
+            return false;
+        }
+        assert(n_steps[s] % n_coarse_codebooks == 0);
 
-    for (int i = 0; i < n_window_steps; i++) {
-        int semantic_idx = roundf(step_idx / stc_ratio);
+        n_steps_total += n_steps[s];
+        n_window_steps = std::max(n_window_steps, (int) ceilf(static_cast<float>(n_steps[s]) / sliding_window_size));
+    }
+
+    // semantic history and infer token, then the coarse history and the window, which together
+    // are at most the coarse tokens of the longest sequence
+    const int n_steps_max = *std::max_element(n_steps.begin(), n_steps.end());
+    if (!bark_grow_kv_cache(model, 256 + 1 + std::min(max_coarse_history + sliding_window_size, n_steps_max), params)) {
+        return false;
+    }
 
-        bark_sequence input_in(
-            input.begin() + std::max(semantic_idx - max_semantic_history, 0),
-            input.end());
+    std::vector<bark_sequence> out(n_seq);
 
-        size_t original_size = input_in.size();
-        input_in.resize(256);
+    std::vector<float> logits;
+    std::vector<float> logits_seq;
 
-        // padding from the right side
-        for (int ix = original_size; ix < 256; ix++) {
-            input_in[ix] = coarse_semantic_pad_token;
-        }
-        input_in.push_back(coarse_infer_token);
+    // sequence decoded in each KV cache slot, with its last token and positions
+    std::vector<int> slot_seq;
+    std::vector<int> n_past;
+    bark_sequence input;
 
-        // concatenate input_in and input_coarse
-        input_in.insert(
-            input_in.end(),
-            std::make_move_iterator(out.end() - std::min(max_coarse_history, (int)out.size())),
-            std::make_move_iterator(out.end()));
+    int n_sampled = 0;
 
-        int n_past = 0;
+    for (int i = 0; i < n_window_steps; i++) {
+        if (stream && stream->stopped)
+            break;
 
         for (int j = 0; j < sliding_window_size; j++) {
-            if (step_idx >= n_steps)
-                continue;
+            const int step_idx = i * sliding_window_size + j;
+
+            int n_active = 0;
+            for (int s = 0; s < n_seq; s++) {
+                n_active += step_idx < n_steps[s];
+            }
+
+            if (n_active == 0)
+                break;
 
             if (params.progress_callback) {
-                const int progress_cur = 100 * (step_idx + 1) / n_steps;
+                const int progress_cur = 100 * (n_sampled + n_active) / n_steps_total;
 
                 params.progress_callback(
                     bctx, bark_encoding_step::COARSE, progress_cur, params.progress_callback_user_data);
             }
 
-            if (!bark_eval_encoder_internal(model, allocr, input_in, logits, &n_past, false, n_threads)) {
-                fprintf(stderr, "%s: Could not generate token\n", __func__);
-                return false;
-            }
+            if (j == 0) {
+                // prompts of the window, one sequence at a time
+                int semantic_idx = roundf(step_idx / stc_ratio);
+
+                slot_seq.clear();
+                for (int s = 0; s < n_seq; s++) {
+                    if (step_idx < n_steps[s]) {
+                        slot_seq.push_back(s);
+                    }
+                }
+
+                n_past.assign(n_active, 0);
+                input.assign(n_active, 0);
+                logits.resize(n_vocab * n_active);
+
+                for (int k = 0; k < n_active; k++) {
+                    const int s = slot_seq[k];
+
+                    bark_sequence input_in(
+                        semantic[s].begin() + std::max(semantic_idx - max_semantic_history, 0),
+                        semantic[s].end());
 
-            input_in.clear();
+                    size_t original_size = input_in.size();
+                    input_in.resize(256);
+
+                    // padding from the right side
+                    for (int ix = original_size; ix < 256; ix++) {
+                        input_in[ix] = coarse_semantic_pad_token;
+                    }
+                    input_in.push_back(coarse_infer_token);
+
+                    // concatenate input_in and input_coarse
+                    input_in.insert(
+                        input_in.end(),
+                        out[s].end() - std::min(max_coarse_history, (int)out[s].size()),
+                        out[s].end());
+
+                    if (!bark_eval_encoder_internal(model, input_in, logits_seq, &n_past[k], false, n_threads, k)) {
+                        fprintf(stderr, "%s: Could not generate token\n", __func__);
+                        return false;
+                    }
+                    std::copy(logits_seq.begin(), logits_seq.end(), logits.begin() + k * n_vocab);
+                }
+            } else {
+                // the finished sequences leave the batch, from the last slot so the moved ones are active
+                for (int k = slot_seq.size() - 1; k >= 0; k--) {
+                    if (step_idx >= n_steps[slot_seq[k]]) {
+                        bark_kv_drop_slot(model, slot_seq, input, n_past, k);
+                    }
+                }
+
+                if (!bark_eval_encoder_step(model, input, n_past, logits, n_threads)) {
+                    fprintf(stderr, "%s: Could not generate token\n", __func__);
+                    return false;
+                }
+            }
 
             bool is_major = step_idx % n_coarse_codebooks == 0;
             int start_idx = semantic_vocab_size + (1 - is_major) * codebook_size;
             int end_idx   = semantic_vocab_size + (2 - is_major) * codebook_size;
 
-            std::vector<float> relevant_logits(logits.begin() + start_idx, logits.begin() + end_idx);
+            for (int k = 0; k < n_active; k++) {
+                const int s = slot_seq[k];
 
-            bark_token next = gpt_sample(
-                relevant_logits, bctx->rng, temp, NULL, &model.t_sample_us, &model.n_sample);
+                bark_token next = gpt_sample(
+                    bctx, model, *rngs[s], logits.data() + k * n_vocab + start_idx, end_idx - start_idx, temp, params.top_k, params.top_p, NULL);
 
-            next += start_idx;
+                next += start_idx;
 
-            input_in.push_back(next);
-            out.push_back(next);
+                input[k] = next;
+                out[s].push_back(next);
+            }
+
+            n_sampled += n_active;
+        }
 
-            step_idx += 1;
+        // decode the audio of the window
+        if (stream && !bark_stream_decode(bctx, stream, out[0], n_threads)) {
+            fprintf(stderr, "%s: Could not decode audio\n", __func__);
+            return false;
         }
     }
 
-    assert((int)out.size() == n_steps);
-    assert(out.size() % n_coarse_codebooks == 0);
+    coarse.assign(n_seq, bark_codes());
 
-    // out_coarse: [seq_length, n_codes]
-    for (int i = 0; i < (int)out.size(); i += n_coarse_codebooks) {
-        // this assumes N_COARSE_CODEBOOKS = 2
-        bark_sequence _tmp = {
-            out[i] - semantic_vocab_size,
-            out[i + 1] - semantic_vocab_size - codebook_size};
-        out_coarse.push_back(_tmp);
+    for (int s = 0; s < n_seq; s++) {
+        assert((int)out[s].size() == n_steps[s] || (stream && stream->stopped));
+        assert(out[s].size() % n_coarse_codebooks == 0);
+
+        // coarse: [seq_length, n_codes]
+        for (int i = 0; i < (int)out[s].size(); i += n_coarse_codebooks) {
+            // this assumes N_COARSE_CODEBOOKS = 2
+            bark_sequence _tmp = {
+                out[s][i] - semantic_vocab_size,
+                out[s][i + 1] - semantic_vocab_size - codebook_size};
+            coarse[s].push_back(_tmp);
+        }
     }
 
-    bctx->coarse_tokens         = out_coarse;
     bctx->stats.n_sample_coarse = model.n_sample;
 
     return true;
 }
 
-bool bark_forward_coarse_encoder(struct bark_context * bctx, int n_threads) {
+bool bark_forward_coarse_encoder(struct bark_context * bctx, struct bark_stream * stream, int n_threads) {
     const int64_t t_main_start_us = ggml_time_us();
 
-    auto & model     = bctx->text_model.coarse_model;
-    auto & allocr    = bctx->allocr;
-    auto & hparams   = model.hparams;
-    auto & verbosity = bctx->params.verbosity;
+    auto & model = bctx->text_model.coarse_model;
 
-    // allocate the compute buffer
-    {
-        // create a graph allocator with the backend's default buffer type
-        bctx->allocr = ggml_gallocr_new(ggml_backend_get_default_buffer_type(model.backend));
+    std::vector<bark_codes> coarse;
 
-        // create the worst-case graph for memory usage estimation
-        int n_past = 0;
-        std::vector<bark_vocab::id> decoy_tokens(hparams.block_size, 0);
-        struct ggml_cgraph * gf = bark_build_gpt_graph(&model, decoy_tokens, &n_past, false /* merge_ctx */);
-
-        // pre-allocate the compute buffer for the worst case (optional)
-        ggml_gallocr_reserve(allocr, gf);
-        size_t mem_size = ggml_gallocr_get_buffer_size(allocr, 0);
-
-        if (verbosity == bark_verbosity_level::MEDIUM || verbosity == bark_verbosity_level::HIGH)
-            fprintf(stderr, "%s: compute buffer size: %.2f MB\n\n", __func__, mem_size / 1024.0 / 1024.0);
-    }
-
-    if (!bark_eval_coarse_encoder(bctx, n_threads)) {
+    if (!bark_eval_coarse_encoder(bctx, { bctx->semantic_tokens }, { &bctx->rng }, coarse, stream, n_threads)) {
         fprintf(stderr, "%s: failed to forward coarse encoder\n", __func__);
         return false;
     }
 
+    bctx->coarse_tokens = coarse[0];
+
     model.t_main_us = ggml_time_us() - t_main_start_us;
-    bctx->stats.t_coarse_us = model.t_main_us;
+    bctx->stats.t_coarse_us = model.t_main_us - (stream ? stream->t_decode_us : 0);
 
     bark_print_statistics(&model);
 
-    ggml_backend_buffer_free(bctx->buf_compute);
-    ggml_gallocr_free(bctx->allocr);
-
     return true;
 }
 
@@ -1911,12 +2899,10 @@ static bool bark_eval_fine_encoder_internal(
     int                   nn,
     int                   n_threads) {
     auto & model   = bctx->text_model.fine_model;
-    auto & allocr  = bctx->allocr;
     auto & hparams = model.hparams;
     auto & params  = bctx->params;
 
-    const int n_vocab    = hparams.n_out_vocab;
-    const int block_size = hparams.block_size;
+    const int n_vocab = hparams.n_out_vocab;
 
     const int n_fine_codebooks = params.n_fine_codebooks;
 
@@ -1927,7 +2913,7 @@ static bool bark_eval_fine_encoder_internal(
     struct ggml_cgraph * gf = bark_build_fine_gpt_graph(&model, input_sequence, nn, n_fine_codebooks);
 
     // allocate the graph tensors
-    ggml_gallocr_alloc_graph(allocr, gf);
+    ggml_gallocr_alloc_graph(model.allocr, gf);
 
     // set the graph inputs
     struct ggml_tensor * input = ggml_graph_get_tensor(gf, "input");
@@ -1951,14 +2937,14 @@ static bool bark_eval_fine_encoder_internal(
 
     struct ggml_tensor* inpL = ggml_graph_get_tensor(gf, "logits");
 
-    ggml_backend_tensor_get(inpL, logits.data(), 0, sizeof(float) * n_vocab * block_size);
+    ggml_backend_tensor_get(inpL, logits.data(), 0, sizeof(float) * n_vocab * N);
 
     model.t_predict_us += ggml_time_us() - t_predict_us_start;
 
     return true;
 }
 
-static bool bark_eval_fine_encoder(struct bark_context * bctx, int n_threads) {
+static bool bark_eval_fine_encoder(struct bark_context * bctx, std::mt19937 & rng, int n_threads) {
     // input shape: [N, n_codes]
     bark_codes input = bctx->coarse_tokens;
 
@@ -2024,18 +3010,10 @@ static bool bark_eval_fine_encoder(struct bark_context * bctx, int n_threads) {
                 fprintf(stderr, "%s: Could not generate token\n", __func__);
                 return false;
             }
-            for (int i = 0; i < 1024; i++) {
-                std::vector<float> relevant_logits(
-                    logits.begin() + i * 1056,
-                    logits.begin() + (i + 1) * 1056);
-                relevant_logits.resize(codebook_size);
-
-                bark_token next = gpt_sample(
-                    relevant_logits, bctx->rng, temp, NULL, &model.t_sample_us,
-                    &model.n_sample);
-
-                in_buffer[nn * 1024 + rel_start_fill_idx + i] = next;
-            }
+            // only the positions from rel_start_fill_idx are filled, the others are context
+            gpt_sample_rows(
+                bctx, model, rng, logits.data() + rel_start_fill_idx * 1056, 1024 - rel_start_fill_idx, 1056,
+                codebook_size, temp, in_buffer.data() + nn * 1024 + rel_start_fill_idx, n_threads);
         }
 
         // transfer over info into model_in
@@ -2058,47 +3036,153 @@ static bool bark_eval_fine_encoder(struct bark_context * bctx, int n_threads) {
     return true;
 }
 
-bool bark_forward_fine_encoder(struct bark_context * bctx, int n_threads) {
+bool bark_forward_fine_encoder(struct bark_context * bctx, std::mt19937 & rng, int n_threads) {
     const int64_t t_main_start_us = ggml_time_us();
 
-    auto & model     = bctx->text_model.fine_model;
-    auto & allocr    = bctx->allocr;
-    auto & hparams   = model.hparams;
-    auto & params    = bctx->params;
-    auto & verbosity = bctx->params.verbosity;
+    auto & model = bctx->text_model.fine_model;
 
-    int32_t n_fine_codebooks = params.n_fine_codebooks;
+    if (!bark_eval_fine_encoder(bctx, rng, n_threads)) {
+        fprintf(stderr, "%s: failed to forward coarse encoder\n", __func__);
+        return false;
+    }
 
-    // allocate the compute buffer
-    {
-        // alignment required by the backend
-        bctx->allocr = ggml_gallocr_new(ggml_backend_get_default_buffer_type(model.backend));
+    model.t_main_us = ggml_time_us() - t_main_start_us;
+    bctx->stats.t_fine_us = model.t_main_us;
+
+    bark_print_statistics(&model);
 
-        // create the worst-case graph for memory usage estimation
-        std::vector<bark_vocab::id> decoy_tokens(hparams.block_size * n_fine_codebooks, 0);
-        struct ggml_cgraph* gf = bark_build_fine_gpt_graph(&model, decoy_tokens, 2 /* codebook_idx */, n_fine_codebooks);
+    return true;
+}
 
-        // pre-allocate the compute buffer for the worst case (optional)
-        ggml_gallocr_reserve(allocr, gf);
-        size_t mem_size =  ggml_gallocr_get_buffer_size(allocr, 0);
+// Run the fine encoder and Encodec on the coarse frames sampled since the last chunk,
+// and pass the new audio to the callback. The fine encoder sees the previous frames as
+// context, with their fine tokens fixed, and Encodec continues from its state after the
+// previous chunk, so the chunks join up without clicks.
+static bool bark_stream_decode(
+    struct bark_context * bctx,
+    struct bark_stream  * stream,
+    const bark_sequence & coarse,
+    int                   n_threads) {
+    auto & model   = bctx->text_model.fine_model;
+    auto & hparams = model.hparams;
+    auto & params  = bctx->params;
 
-        if (verbosity == bark_verbosity_level::MEDIUM || verbosity == bark_verbosity_level::HIGH) {
-            fprintf(stderr, "%s: compute buffer size: %.2f MB\n\n", __func__, mem_size / 1024.0 / 1024.0);
+    const int64_t t_start_us = ggml_time_us();
+
+    const int n_vocab    = hparams.n_out_vocab;
+    const int block_size = hparams.block_size;
+
+    const int32_t n_coarse_codebooks  = params.n_coarse_codebooks;
+    const int32_t n_fine_codebooks    = params.n_fine_codebooks;
+    const int32_t codebook_size       = params.codebook_size;
+    const int32_t semantic_vocab_size = params.semantic_vocab_size;
+
+    const int n_frames = coarse.size() / n_coarse_codebooks;
+    const int n_done   = stream->fine_tokens.size();
+
+    if (n_frames <= n_done)
+        return true;
+
+    // frames to run, with the context first
+    const int start = std::max(0, n_done - params.n_stream_context);
+    const int N     = n_frames - start;
+    const int n_ctx = n_done - start;
+
+    if (N > block_size) {
+        fprintf(stderr, "%s: chunk of %d frames is longer than the fine encoder block size %d\n", __func__, N, block_size);
+        return false;
+    }
+
+    // in_buffer: [n_codes*N] (sequences are contiguous)
+    // fine tokens of the context, coarse tokens and padding for the new frames
+    bark_sequence in_buffer(n_fine_codebooks * N, codebook_size);
+    for (int j = 0; j < N; j++) {
+        const int t = start + j;
+        for (int i = 0; i < n_fine_codebooks; i++) {
+            if (t < n_done) {
+                in_buffer[i * N + j] = stream->fine_tokens[t][i];
+            } else if (i < n_coarse_codebooks) {
+                in_buffer[i * N + j] = coarse[t * n_coarse_codebooks + i] - semantic_vocab_size - i * codebook_size;
+            }
         }
     }
 
-    if (!bark_eval_fine_encoder(bctx, n_threads)) {
-        fprintf(stderr, "%s: failed to forward coarse encoder\n", __func__);
+    // fine tokens of the new frames
+    std::vector<float> logits(n_vocab * N);
+
+    for (int nn = n_coarse_codebooks; nn < n_fine_codebooks; nn++) {
+        if (!bark_eval_fine_encoder_internal(bctx, in_buffer, logits, nn, n_threads)) {
+            fprintf(stderr, "%s: Could not generate token\n", __func__);
+            return false;
+        }
+
+        for (int j = n_ctx; j < N; j++) {
+            in_buffer[nn * N + j] = gpt_sample(
+                bctx, model, bctx->rng, logits.data() + j * n_vocab, codebook_size, params.fine_temp, 0, 1.0f, NULL);
+        }
+    }
+
+    for (int j = n_ctx; j < N; j++) {
+        bark_sequence frame(n_fine_codebooks);
+        for (int i = 0; i < n_fine_codebooks; i++) {
+            frame[i] = in_buffer[i * N + j];
+        }
+        stream->fine_tokens.push_back(frame);
+    }
+
+    bctx->stats.t_fine_us += ggml_time_us() - t_start_us;
+    bctx->stats.n_sample_fine = model.n_sample;
+
+    // codes of the new frames in the layout encodec expects: [n_channels][seq_length]
+    const int n_new = N - n_ctx;
+
+    bark_sequence codes(n_fine_codebooks * n_new);
+    for (int i = 0; i < n_fine_codebooks; i++) {
+        std::copy_n(in_buffer.data() + i * N + n_ctx, n_new, codes.data() + i * n_new);
+    }
+
+    if (!encodec_decompress_audio_stream(bctx->encodec_ctx, codes.data(), codes.size(), n_threads)) {
+        fprintf(stderr, "%s: Could not generate waveform from tokens with Encodec\n", __func__);
         return false;
     }
 
-    model.t_main_us = ggml_time_us() - t_main_start_us;
-    bctx->stats.t_fine_us = model.t_main_us;
+    const float * audio = encodec_get_audio(bctx->encodec_ctx);
+    const int n_audio   = encodec_get_audio_size(bctx->encodec_ctx);
 
-    bark_print_statistics(&model);
+    bctx->streamed_audio.insert(bctx->streamed_audio.end(), audio, audio + n_audio);
 
-    ggml_backend_buffer_free(bctx->buf_compute);
-    ggml_gallocr_free(bctx->allocr);
+    stream->t_decode_us += ggml_time_us() - t_start_us;
+
+    // the first frames are held back by Encodec until there are enough for its convolutions
+    if (n_audio > 0 && !stream->callback(bctx, audio, n_audio, stream->user_data)) {
+        stream->stopped = true;
+    }
+
+    return true;
+}
+
+// Pass the audio of the frames Encodec still holds back to the callback, once the coarse
+// encoder is done. A stream shorter than the convolutions of Encodec is only decoded here.
+static bool bark_stream_flush(
+    struct bark_context * bctx,
+    struct bark_stream  * stream,
+    int                   n_threads) {
+    if (stream->stopped)
+        return true;
+
+    if (!encodec_flush_stream(bctx->encodec_ctx, n_threads)) {
+        fprintf(stderr, "%s: Could not generate waveform from tokens with Encodec\n", __func__);
+        return false;
+    }
+
+    const float * audio = encodec_get_audio(bctx->encodec_ctx);
+    const int n_audio   = encodec_get_audio_size(bctx->encodec_ctx);
+
+    bctx->streamed_audio.insert(bctx->streamed_audio.end(), audio, audio + n_audio);
+
+    if (n_audio > 0 && !stream->callback(bctx, audio, n_audio, stream->user_data)) {
+        stream->stopped = true;
+    }
 
     return true;
 }
@@ -2109,12 +3193,12 @@ static bool bark_forward_eval(struct bark_context * bctx, int n_threads) {
         return false;
     }
 
-    if (!bark_forward_coarse_encoder(bctx, n_threads)) {
+    if (!bark_forward_coarse_encoder(bctx, NULL, n_threads)) {
         fprintf(stderr, "%s: failed to forward coarse encoder\n", __func__);
         return false;
     }
 
-    if (!bark_forward_fine_encoder(bctx, n_threads)) {
+    if (!bark_forward_fine_encoder(bctx, bctx->rng, n_threads)) {
         fprintf(stderr, "%s: failed to forward fine encoder\n", __func__);
         return false;
     }
@@ -2122,6 +3206,36 @@ static bool bark_forward_eval(struct bark_context * bctx, int n_threads) {
     return true;
 }
 
+static bool bark_forward_encodec(struct bark_context * bctx, int n_threads) {
+    auto & params = bctx->params;
+
+    int32_t target_bandwidth = params.target_bandwidth;
+    int32_t sample_rate = params.sample_rate;
+
+    encodec_set_target_bandwidth(bctx->encodec_ctx, target_bandwidth);
+    encodec_set_sample_rate(bctx->encodec_ctx, sample_rate);
+
+    // current shape fine_tokens: [seq_length][n_channels], n_channels are contiguous
+    // encodec expects shape fine_tokens: [n_channels][seq_length], time steps are contiguous
+    std::vector<bark_vocab::id> encodec_tokens;
+
+    for (int i = 0; i < (int)bctx->fine_tokens[0].size(); i++) {
+        for (int j = 0; j < (int)bctx->fine_tokens.size(); j++) {
+            encodec_tokens.push_back(bctx->fine_tokens[j][i]);
+        }
+    }
+
+    if (!encodec_decompress_audio(bctx->encodec_ctx, encodec_tokens.data(), encodec_tokens.size(), n_threads)) {
+        printf("%s: Could not generate waveform from tokens with Encodec\n", __func__);
+        return false;
+    }
+
+    bctx->generated_audio     = encodec_get_audio(bctx->encodec_ctx);
+    bctx->n_generated_samples = encodec_get_audio_size(bctx->encodec_ctx);
+
+    return true;
+}
+
 bool bark_generate_audio(struct bark_context * bctx, const char * text, int n_threads) {
     if (!bctx) {
         fprintf(stderr, "%s: invalid bark context\n", __func__);
@@ -2140,31 +3254,146 @@ bool bark_generate_audio(struct bark_context * bctx, const char * text, int n_th
         return false;
     }
 
-    auto & params = bctx->params;
+    if (!bark_forward_encodec(bctx, n_threads)) {
+        fprintf(stderr, "%s: failed to forward encodec\n", __func__);
+        return false;
+    }
 
-    int32_t target_bandwidth = params.target_bandwidth;
-    int32_t sample_rate = params.sample_rate;
+    bctx->stats.t_eval_us = ggml_time_us() - t_start_eval_us;
 
-    encodec_set_target_bandwidth(bctx->encodec_ctx, target_bandwidth);
-    encodec_set_sample_rate(bctx->encodec_ctx, sample_rate);
+    return true;
+}
 
-    // current shape fine_tokens: [seq_length][n_channels], n_channels are contiguous
-    // encodec expects shape fine_tokens: [n_channels][seq_length], time steps are contiguous
-    std::vector<bark_vocab::id> encodec_tokens;
+bool bark_generate_audio_batch(
+    struct bark_context * bctx,
+    const char         ** texts,
+    int                   n_texts,
+    int                   n_threads) {
+    if (!bctx) {
+        fprintf(stderr, "%s: invalid bark context\n", __func__);
+        return false;
+    }
 
-    for (int i = 0; i < (int)bctx->fine_tokens[0].size(); i++) {
-        for (int j = 0; j < (int)bctx->fine_tokens.size(); j++) {
-            encodec_tokens.push_back(bctx->fine_tokens[j][i]);
+    bark_reset_statistics(bctx);
+
+    int64_t t_start_eval_us = ggml_time_us();
+
+    const int n_batch = bctx->params.n_batch;
+
+    bctx->batch_audio.assign(n_texts, std::vector<float>());
+
+    for (int i0 = 0; i0 < n_texts; i0 += n_batch) {
+        const int n_seq = std::min(n_batch, n_texts - i0);
+
+        std::vector<bark_sequence> prompts(n_seq);
+        for (int s = 0; s < n_seq; s++) {
+            bark_tokenize_input(bctx, std::string(texts[i0 + s]));
+            prompts[s] = bctx->tokens;
+        }
+
+        // each text has its own generator seeded from its index, so its audio does not
+        // depend on the other texts of the batch
+        std::vector<std::mt19937> rngs(n_seq);
+        std::vector<std::mt19937 *> rng_ptrs(n_seq);
+        for (int s = 0; s < n_seq; s++) {
+            std::seed_seq seq = { bctx->seed, (uint32_t) (i0 + s) };
+            rngs[s].seed(seq);
+            rng_ptrs[s] = &rngs[s];
+        }
+
+        // the text and coarse encoders run the batch together
+        std::vector<bark_sequence> semantic;
+        if (!bark_eval_text_encoder(bctx, prompts, rng_ptrs, semantic, n_threads)) {
+            fprintf(stderr, "%s: failed to forward text encoder\n", __func__);
+            return false;
+        }
+
+        std::vector<bark_codes> coarse;
+        if (!bark_eval_coarse_encoder(bctx, semantic, rng_ptrs, coarse, NULL, n_threads)) {
+            fprintf(stderr, "%s: failed to forward coarse encoder\n", __func__);
+            return false;
+        }
+
+        // the fine encoder and Encodec run on each text in turn
+        for (int s = 0; s < n_seq; s++) {
+            bctx->semantic_tokens = semantic[s];
+            bctx->coarse_tokens   = coarse[s];
+
+            if (!bark_forward_fine_encoder(bctx, rngs[s], n_threads)) {
+                fprintf(stderr, "%s: failed to forward fine encoder\n", __func__);
+                return false;
+            }
+
+            if (!bark_forward_encodec(bctx, n_threads)) {
+                fprintf(stderr, "%s: failed to forward encodec\n", __func__);
+                return false;
+            }
+
+            bctx->batch_audio[i0 + s].assign(bctx->generated_audio, bctx->generated_audio + bctx->n_generated_samples);
         }
     }
 
-    if (!encodec_decompress_audio(bctx->encodec_ctx, encodec_tokens.data(), encodec_tokens.size(), n_threads)) {
-        printf("%s: Could not generate waveform from tokens with Encodec\n", __func__);
+    bctx->stats.t_eval_us = ggml_time_us() - t_start_eval_us;
+
+    return true;
+}
+
+bool bark_generate_audio_streaming(
+    struct bark_context * bctx,
+    const char          * text,
+    int                   n_threads,
+    bark_audio_callback   callback,
+    void                * user_data) {
+    if (!bctx) {
+        fprintf(stderr, "%s: invalid bark context\n", __func__);
         return false;
     }
 
-    bctx->generated_audio     = encodec_get_audio(bctx->encodec_ctx);
-    bctx->n_generated_samples = encodec_get_audio_size(bctx->encodec_ctx);
+    if (!callback) {
+        fprintf(stderr, "%s: no audio callback\n", __func__);
+        return false;
+    }
+
+    bark_reset_statistics(bctx);
+
+    int64_t t_start_eval_us = ggml_time_us();
+
+    std::string text_str(text);
+    bark_tokenize_input(bctx, text_str);
+
+    auto & params = bctx->params;
+
+    encodec_set_target_bandwidth(bctx->encodec_ctx, params.target_bandwidth);
+    encodec_set_sample_rate(bctx->encodec_ctx, params.sample_rate);
+
+    // the semantic tokens condition every coarse window, so they are generated first
+    if (!bark_forward_text_encoder(bctx, n_threads)) {
+        fprintf(stderr, "%s: failed to forward text encoder\n", __func__);
+        return false;
+    }
+
+    struct bark_stream stream;
+    stream.callback  = callback;
+    stream.user_data = user_data;
+
+    // the fine encoder and Encodec run after each window of coarse tokens
+    bctx->streamed_audio.clear();
+    encodec_reset_stream(bctx->encodec_ctx);
+
+    if (!bark_forward_coarse_encoder(bctx, &stream, n_threads)) {
+        fprintf(stderr, "%s: failed to forward coarse encoder\n", __func__);
+        return false;
+    }
+
+    if (!bark_stream_flush(bctx, &stream, n_threads)) {
+        fprintf(stderr, "%s: failed to flush the audio stream\n", __func__);
+        return false;
+    }
+
+    bctx->fine_tokens = stream.fine_tokens;
+
+    bctx->generated_audio     = bctx->streamed_audio.data();
+    bctx->n_generated_samples = bctx->streamed_audio.size();
 
     bctx->stats.t_eval_us = ggml_time_us() - t_start_eval_us;
 
@@ -2181,7 +3410,15 @@ static void bark_free_model(struct gpt_model * model) {
     if (model->ctx_kv)
         ggml_free(model->ctx_kv);
 
+    if (model->allocr)
+        ggml_gallocr_free(model->allocr);
+
+    if (model->allocr_step)
+        ggml_gallocr_free(model->allocr_step);
+
     ggml_backend_buffer_free(model->buffer_w);
+    ggml_backend_buffer_free(model->buffer_mapped);
+    ggml_backend_buffer_free(model->buffer_repacked);
     ggml_backend_buffer_free(model->buffer_kv);
     ggml_backend_free(model->backend);
 }
@@ -2204,14 +3441,26 @@ struct bark_context_params bark_context_default_params() {
         /*.verbosity                   =*/ bark_verbosity_level::LOW,
         /*.temp                        =*/ 0.7,
         /*.fine_temp                   =*/ 0.5,
+        /*.top_k                       =*/ 0,
+        /*.top_p                       =*/ 1.0,
         /*.min_eos_p                   =*/ 0.2,
+        /*.eos_patience                =*/ 0,
         /*.sliding_window_size         =*/ 60,
         /*.max_coarse_history          =*/ 630,
+        /*.n_stream_context            =*/ 64,
+        /*.type_k                      =*/ GGML_TYPE_F16,
+        /*.type_v                      =*/ GGML_TYPE_F16,
+        /*.n_batch                     =*/ 1,
+        /*.use_mmap                    =*/ true,
+        /*.mmap_prefetch               =*/ false,
+        /*.threadpool                  =*/ nullptr,
+        /*.threadpool_lane             =*/ 0,
         /*.sample_rate                 =*/ 24000,
         /*.target_bandwidth            =*/ 6,
         /*.cls_token_id                =*/ 101,
         /*.sep_token_id                =*/ 102,
         /*.n_steps_text_encoder        =*/ 768,
+        /*.text_rate_hz                =*/ 0.0f,
         /*.text_pad_token              =*/ 129595,
         /*.text_encoding_offset        =*/ 10048,
         /*.semantic_rate_hz            =*/ 49.9f,
@@ -2363,7 +3612,8 @@ bool bark_model_quantize(const char * fname_inp, const char * fname_out, enum gg
         return false;
     }
 
-    // neural codec (not quantized, since this seriously degrates the audio quality)
+    // neural codec (not quantized, since this seriously degrates the audio quality, its decoder
+    // is quantized separately with encodec_model_quantize once the audio is checked)
     // copy the rest of fin to fout
     char c;
     while (fin.get(c)) {
@@ -2376,6 +3626,18 @@ bool bark_model_quantize(const char * fname_inp, const char * fname_out, enum gg
     return true;
 }
 
+float* bark_get_batch_audio_data(struct bark_context * bctx, int i) {
+    if (!bctx || i < 0 || i >= (int)bctx->batch_audio.size())
+        return nullptr;
+    return bctx->batch_audio[i].data();
+}
+
+int bark_get_batch_audio_data_size(struct bark_context * bctx, int i) {
+    if (!bctx || i < 0 || i >= (int)bctx->batch_audio.size())
+        return 0;
+    return bctx->batch_audio[i].size();
+}
+
 float* bark_get_audio_data(struct bark_context * bctx) {
     if (!bctx)
         return nullptr;
@@ -57,6 +57,9 @@ extern "C" {
 
     typedef void (*bark_progress_callback)(struct bark_context * bctx, enum bark_encoding_step step, int progress, void * user_data);
 
+    // Receives each chunk of audio as soon as it is decoded, return false to stop the generation
+    typedef bool (*bark_audio_callback)(struct bark_context * bctx, const float * audio, int n_samples, void * user_data);
+
     struct bark_statistics {
         // Time to load model weights
         int64_t t_load_us;
@@ -86,13 +89,39 @@ extern "C" {
         float temp;
         // Temperature for sampling (fine encoder)
         float fine_temp;
+        // Only sample from the k most likely tokens, 0 to disable (text and coarse encoders)
+        int32_t top_k;
+        // Only sample from the most likely tokens up to this probability, 1 to disable (text and coarse encoders)
+        float top_p;
 
         // Minimum probability for EOS token (text encoder)
         float min_eos_p;
+        // Stop once the probability of EOS rose for this many steps and is above half of min_eos_p, 0 to disable (text encoder)
+        int32_t eos_patience;
         // Sliding window size for coarse encoder
         int32_t sliding_window_size;
         // Max history for coarse encoder
         int32_t max_coarse_history;
+        // Frames of context before each chunk when streaming (fine encoder)
+        int32_t n_stream_context;
+
+        // Type of the keys in the KV cache: F32, F16 or Q8_0 (text and coarse encoders)
+        enum ggml_type type_k;
+        // Type of the values in the KV cache: F32 or F16 (text and coarse encoders)
+        enum ggml_type type_v;
+        // Maximum number of prompts generated together, each has its own KV cache
+        int32_t n_batch;
+
+        // Map the model file and use the CPU weights in place instead of copying them
+        bool use_mmap;
+        // Populate the mapping up front so the first generation does not page fault through the weights
+        bool mmap_prefetch;
+
+        // CPU threadpool shared with other models, NULL to start threads for each graph. The
+        // graphs of the models, of Encodec and of the fine token sampling all run on it
+        struct ggml_threadpool * threadpool;
+        // Lane waiting for the shared threadpool, 0 is the most urgent
+        int32_t threadpool_lane;
 
         // Sample rate
         int32_t sample_rate;
@@ -106,6 +135,8 @@ extern "C" {
 
         // Maximum number of semantic tokens to generate
         int32_t n_steps_text_encoder;
+        // Slowest expected speech in text tokens per second, bounds the semantic tokens of each prompt, 0 to disable
+        float text_rate_hz;
 
         // Text PAD token ID
         int32_t text_pad_token;
@@ -160,6 +191,17 @@ extern "C" {
         struct bark_context_params params,
         uint32_t seed);
 
+    /**
+     * Restarts the random number generator of the context from the given seed. The
+     * generations of a text that follow the same seed produce the same audio.
+     *
+     * @param bctx The Bark context.
+     * @param seed The seed to use for random number generation.
+     */
+    BARK_API void bark_set_seed(
+        struct bark_context *bctx,
+        uint32_t seed);
+
     /**
      * Generates an audio file from the given text using the specified Bark context.
      *
@@ -173,6 +215,65 @@ extern "C" {
         const char *text,
         int n_threads);
 
+    /**
+     * Generates audio from the given text, and delivers it in chunks while generating.
+     * The fine encoder and Encodec run on each window of coarse tokens as soon as it
+     * is sampled, so the first chunk arrives long before the whole audio is generated.
+     *
+     * @param bctx The Bark context to use for generating the audio.
+     * @param text The text to generate audio from.
+     * @param n_threads The number of threads to use for generating the audio.
+     * @param callback The function receiving the chunks of audio.
+     * @param user_data The user data passed to the callback.
+     * @return An integer indicating the success of the audio generation process.
+     */
+    BARK_API bool bark_generate_audio_streaming(
+        struct bark_context *bctx,
+        const char *text,
+        int n_threads,
+        bark_audio_callback callback,
+        void *user_data);
+
+    /**
+     * Generates the audio of several texts together. The text and coarse encoders run
+     * up to n_batch texts as a batch, one token of each text per step, and the fine
+     * encoder and Encodec run on each text in turn. Each text samples from its own
+     * generator, seeded from the seed of the context and the index of the text.
+     *
+     * @param bctx The Bark context to use for generating the audio.
+     * @param texts The texts to generate audio from.
+     * @param n_texts The number of texts.
+     * @param n_threads The number of threads to use for generating the audio.
+     * @return An integer indicating the success of the audio generation process.
+     */
+    BARK_API bool bark_generate_audio_batch(
+        struct bark_context *bctx,
+        const char **texts,
+        int n_texts,
+        int n_threads);
+
+    /**
+     * Retrieves the audio data of a text of the last batch generated by the Bark context.
+     *
+     * @param bctx The Bark context to use for generating the audio.
+     * @param i The index of the text in the batch.
+     * @return A pointer to the audio data of the text.
+     */
+    BARK_API float *bark_get_batch_audio_data(
+        struct bark_context *bctx,
+        int i);
+
+    /**
+     * Retrieves the audio data size of a text of the last batch generated by the Bark context.
+     *
+     * @param bctx The Bark context to use for generating the audio.
+     * @param i The index of the text in the batch.
+     * @return The size of the audio data of the text.
+     */
+    BARK_API int bark_get_batch_audio_data_size(
+        struct bark_context *bctx,
+        int i);
+
     /**
      * Retrieves the audio data generated by the Bark context.
      *
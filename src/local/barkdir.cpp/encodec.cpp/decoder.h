@@ -7,51 +7,48 @@
 #include "ggml-backend.h"
 
 #include "lstm.h"
+#include "ops.h"
 #include "utils.h"
 
 
 struct encodec_decoder_block {
     // upsampling layers
-    struct ggml_tensor *us_conv_w;
-    struct ggml_tensor *us_conv_b;
+    struct encodec_conv us_conv;
 
     // conv1
-    struct ggml_tensor *conv_1_w;
-    struct ggml_tensor *conv_1_b;
+    struct encodec_conv conv_1;
 
     // conv2
-    struct ggml_tensor *conv_2_w;
-    struct ggml_tensor *conv_2_b;
+    struct encodec_conv conv_2;
 
     // shortcut
-    struct ggml_tensor *conv_sc_w;
-    struct ggml_tensor *conv_sc_b;
+    struct encodec_conv conv_sc;
 };
 
 struct encodec_decoder {
-    struct ggml_tensor *init_conv_w;
-    struct ggml_tensor *init_conv_b;
+    struct encodec_conv init_conv;
 
     encodec_lstm lstm;
 
-    struct ggml_tensor *final_conv_w;
-    struct ggml_tensor *final_conv_b;
+    struct encodec_conv final_conv;
 
     std::vector<encodec_decoder_block> blocks;
 };
 
+// With a stream, quantized_out is a chunk of the frames, and the states of the convolutions and
+// of the LSTM continue from the previous chunk
 struct ggml_tensor *encodec_forward_decoder(
     const struct encodec_decoder *decoder, struct ggml_context *ctx0,
     struct ggml_tensor *quantized_out, const int *ratios, const int kernel_size, const int res_kernel_size,
-    const int stride) {
+    const int stride, struct encodec_stream *stream) {
 
     if (!quantized_out) {
         fprintf(stderr, "%s: null input tensor\n", __func__);
         return NULL;
     }
 
-    struct ggml_tensor *inpL = strided_conv_1d(
-        ctx0, quantized_out, decoder->init_conv_w, decoder->init_conv_b, stride);
+    struct ggml_tensor *inpL = strided_conv_1d_stream(
+        ctx0, quantized_out, &decoder->init_conv, stride, stream);
 
     // lstm
     {
@@ -62,12 +59,12 @@ struct ggml_tensor *encodec_forward_decoder(
         // first lstm layer
         char l0_prefix[7] = "dec_l0";
         struct ggml_tensor *hs1 = forward_pass_lstm_unilayer(
-            ctx0, cur, lstm.l0_ih_w, lstm.l0_hh_w, lstm.l0_ih_b, lstm.l0_hh_b, l0_prefix);
+            ctx0, cur, lstm.l0_ih_w, lstm.l0_hh_w, lstm.l0_ih_b, lstm.l0_hh_b, l0_prefix, stream);
 
         // second lstm layer
         char l1_prefix[7] = "dec_l1";
         struct ggml_tensor *out = forward_pass_lstm_unilayer(
-            ctx0, hs1, lstm.l1_ih_w, lstm.l1_hh_w, lstm.l1_ih_b, lstm.l1_hh_b, l1_prefix);
+            ctx0, hs1, lstm.l1_ih_w, lstm.l1_hh_w, lstm.l1_ih_b, lstm.l1_hh_b, l1_prefix, stream);
 
         inpL = ggml_add(ctx0, inpL, out);
     }
@@ -78,26 +75,26 @@ struct ggml_tensor *encodec_forward_decoder(
         // upsampling layers
         inpL = ggml_elu(ctx0, inpL);
 
-        inpL = strided_conv_transpose_1d(
-            ctx0, inpL, block.us_conv_w, block.us_conv_b, ratios[layer_ix]);
+        inpL = strided_conv_transpose_1d_stream(
+            ctx0, inpL, &block.us_conv, ratios[layer_ix], stream);
 
         struct ggml_tensor *current = inpL;
 
         // shortcut
-        struct ggml_tensor *shortcut = strided_conv_1d(
-            ctx0, inpL, block.conv_sc_w, block.conv_sc_b, stride);
+        struct ggml_tensor *shortcut = strided_conv_1d_stream(
+            ctx0, inpL, &block.conv_sc, stride, stream);
 
         // conv1
         current = ggml_elu(ctx0, current);
 
-        current = strided_conv_1d(
-            ctx0, current, block.conv_1_w, block.conv_1_b, stride);
+        current = strided_conv_1d_stream(
+            ctx0, current, &block.conv_1, stride, stream);
 
         // conv2
         current = ggml_elu(ctx0, current);
 
-        current = strided_conv_1d(
-            ctx0, current, block.conv_2_w, block.conv_2_b, stride);
+        current = strided_conv_1d_stream(
+            ctx0, current, &block.conv_2, stride, stream);
 
         // residual connection
         inpL = ggml_add(ctx0, current, shortcut);
@@ -106,8 +103,8 @@ struct ggml_tensor *encodec_forward_decoder(
     // final conv
     inpL = ggml_elu(ctx0, inpL);
 
-    struct ggml_tensor *decoded_inp = strided_conv_1d(
-        ctx0, inpL, decoder->final_conv_w, decoder->final_conv_b, stride);
+    struct ggml_tensor *decoded_inp = strided_conv_1d_stream(
+        ctx0, inpL, &decoder->final_conv, stride, stream);
 
     return decoded_inp;
 }
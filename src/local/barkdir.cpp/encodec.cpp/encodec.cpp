@@ -1,7 +1,7 @@
 #include "ggml-alloc.h"
 #include "ggml-backend.h"
 #include "ggml.h"
-#include "ggml/src/ggml-impl.h"
+#include "ggml-cpu.h"
 
 #ifdef GGML_USE_CUBLAS
 #include "ggml-cuda.h"
@@ -11,6 +11,7 @@
 #include "ggml-metal.h"
 #endif
 
+#include <algorithm>
 #include <cassert>
 #include <cmath>
 #include <cstring>
@@ -18,6 +19,7 @@
 #include <iostream>
 #include <map>
 #include <memory>
+#include <set>
 #include <stdexcept>
 #include <string>
 #include <vector>
@@ -35,6 +37,9 @@
 #define ENCODEC_FILE_MAGIC 'ggml'
 #define ENCODEC_MAX_NODES 80000
 
+// graph size when the LSTM is fused, it does not depend on the length of the audio
+#define ENCODEC_MAX_NODES_FUSED 4096
+
 typedef enum {
     // Run the end-to-end encoder-decoder pipeline
     FULL = 0,
@@ -42,6 +47,10 @@ typedef enum {
     ENCODE = 1,
     // Decode an audio from a compressed representation (quantizer decode + decoder)
     DECODE = 2,
+    // Decode a chunk of a stream, continuing from the state left by the previous chunk
+    DECODE_STREAM = 3,
+    // Encode a chunk of a stream, continuing from the state left by the previous chunk
+    ENCODE_STREAM = 4,
 } encodec_run_mode_t;
 
 struct encodec_hparams {
@@ -93,39 +102,75 @@ struct encodec_model {
 
     ggml_backend_t backend = NULL;
 
-    ggml_backend_buffer_t buffer_w;
+    ggml_backend_buffer_t buffer_w = NULL;
+
+    // weights used in place from the model file mapped by the caller
+    ggml_backend_buffer_t buffer_mapped = NULL;
+
+    // views of the convolution weights packed in place for the CPU backend
+    struct ggml_context *ctx_packed = NULL;
 
     std::map<std::string, struct ggml_tensor *> tensors;
 };
 
-struct encodec_ggml_cgraph_deleter {
-    void operator()(struct ggml_cgraph * cgraph) {
-        if (cgraph->nodes)
-            free(cgraph->nodes);
-        if (cgraph->leafs)
-            free(cgraph->leafs);
-        if (cgraph->visited_hash_set.keys)
-            free(cgraph->visited_hash_set.keys);
-        if (cgraph->grads)
-            free(cgraph->grads);
-        free(cgraph);
+// Model file, read from a stream or from memory such as a mapped file
+struct encodec_model_file {
+    std::ifstream * fin = NULL;
+
+    const char * data = NULL;
+    size_t size = 0;
+    size_t pos  = 0;
+
+    void read(char * dst, size_t n) {
+        if (fin) {
+            fin->read(dst, n);
+            return;
+        }
+        memcpy(dst, data + std::min(pos, size), std::min(n, size - std::min(pos, size)));
+        pos += n;
+    }
+
+    bool eof() {
+        return fin ? fin->eof() : pos > size;
+    }
+
+    void close() {
+        if (fin) {
+            fin->close();
+        }
     }
 };
 
+template <typename T>
+static void read_safe(encodec_model_file &infile, T &dest) {
+    infile.read((char *)&dest, sizeof(T));
+}
+
 struct encodec_context {
     encodec_model model;
 
-    // computational graph stored on the heap to avoid stack overflows
-    // the computational graph grows with the sequence length (because of the LSTM)
+    // computational graph, it grows with the sequence length (because of the LSTM)
     // which requires a lot of nodes
-    std::unique_ptr<struct ggml_cgraph, encodec_ggml_cgraph_deleter> gf;
+    struct ggml_cgraph * gf = nullptr;
+
+    // memory of the graph and of its ggml_tensor structs
+    std::vector<uint8_t> buf_graph;
+
+    // the graph is kept allocated and reused by the next run with the same shape
+    encodec_run_mode_t graph_mode = encodec_run_mode_t::FULL;
+    int  graph_length    = 0;  // samples or frames of the input
+    int  graph_bandwidth = 0;
+    bool graph_started   = false;
 
     // buffer for model evaluation
     ggml_backend_buffer_t buf_compute;
 
-    // tensor graph allocator
+    // tensor graph allocator, the compute buffer only grows
     ggml_gallocr_t allocr = NULL;
 
+    // codes padded to the length of the graph
+    std::vector<int32_t> inp_codes;
+
     // intermediate steps
     struct ggml_tensor *encoded = NULL;  // Encoded audio
     struct ggml_tensor *codes = NULL;    // Quantized representation of audio in codebook
@@ -134,11 +179,95 @@ struct encodec_context {
     std::vector<int32_t> out_codes;
     std::vector<float> out_audio;
 
+    // state of the decoder between the chunks of a stream
+    encodec_stream stream;
+    // state of the encoder between the chunks of a stream
+    encodec_stream encode_stream;
+
     // statistics
     encodec_statistics stats;
 };
 
-bool encodec_load_model_weights(std::ifstream &infile, encodec_model &model, int n_gpu_layers) {
+// Quantized models only quantize the weights of the decoder, the other weights are in F16. The
+// convolutions are stored packed as [in_channels, kernel_size, out_channels], so that the blocks
+// run along the input channels as the dot products of the direct convolutions in ops.cpp. Rows
+// whose length is not a multiple of the block size are left in F16.
+static bool encodec_quantize_rows(ggml_type qtype, int64_t n) {
+    return qtype != GGML_TYPE_COUNT && n % ggml_blck_size(qtype) == 0;
+}
+
+// Permutes the elements of the weight of a convolution [kernel_size, in_channels, out_channels],
+// or of a transposed convolution [kernel_size, out_channels, in_channels], to the packed
+// [in_channels, kernel_size, out_channels]. The taps of a transposed convolution are reordered
+// for its stride, see conv_transpose_1d_kernel.
+static void encodec_pack_conv_data(const char *src, char *dst, size_t el, int64_t kernel_size,
+                                   int64_t n_in, int64_t n_out, int transposed_stride) {
+    const int stride = transposed_stride;
+    for (int64_t o = 0; o < n_out; o++) {
+        for (int64_t kk = 0; kk < kernel_size; kk++) {
+            int64_t k = kk;
+            if (stride) {
+                // taps of each phase r by decreasing m
+                const int64_t n_taps = kernel_size / stride;
+                k = kk / n_taps + (n_taps - 1 - kk % n_taps) * stride;
+            }
+            for (int64_t c = 0; c < n_in; c++) {
+                const int64_t i = stride ? k + kernel_size * (o + n_out * c)
+                                         : k + kernel_size * (c + n_in * o);
+                memcpy(dst + ((o * kernel_size + kk) * n_in + c) * el, src + i * el, el);
+            }
+        }
+    }
+}
+
+struct encodec_conv_layer {
+    struct encodec_conv *conv;
+    int transposed_stride;  // 0 for a convolution
+};
+
+// The convolutions of the encoder and of the decoder
+static std::vector<encodec_conv_layer> encodec_conv_layers(encodec_model &model) {
+    std::vector<encodec_conv_layer> convs;
+
+    const int *ratios = model.hparams.ratios;
+
+    auto &encoder = model.encoder;
+    convs.push_back({&encoder.init_conv, 0});
+    for (auto &block : encoder.blocks) {
+        convs.push_back({&block.conv_1, 0});
+        convs.push_back({&block.conv_2, 0});
+        convs.push_back({&block.conv_sc, 0});
+        convs.push_back({&block.ds_conv, 0});
+    }
+    convs.push_back({&encoder.final_conv, 0});
+
+    auto &decoder = model.decoder;
+    convs.push_back({&decoder.init_conv, 0});
+    for (size_t i = 0; i < decoder.blocks.size(); i++) {
+        auto &block = decoder.blocks[i];
+        convs.push_back({&block.us_conv, ratios[i]});
+        convs.push_back({&block.conv_1, 0});
+        convs.push_back({&block.conv_2, 0});
+        convs.push_back({&block.conv_sc, 0});
+    }
+    convs.push_back({&decoder.final_conv, 0});
+
+    return convs;
+}
+
+// Whether the weights of a convolution are packed when the model is loaded on the CPU backend.
+// Convolutions over a few channels, such as the first one of the encoder, are left to
+// ggml_conv_1d, and the quantized weights are already packed in the model file.
+static bool encodec_conv_repacked(const encodec_conv_layer &layer) {
+    const struct ggml_tensor *w = layer.conv->w;
+    const int stride = layer.transposed_stride;
+
+    const int64_t n_in = stride ? w->ne[2] : w->ne[1];
+    return !ggml_is_quantized(w->type) && ggml_blck_size(w->type) == 1 && n_in >= 8 &&
+           (!stride || w->ne[0] % stride == 0);
+}
+
+bool encodec_load_model_weights(encodec_model_file &infile, encodec_model &model, int n_gpu_layers) {
     // verify magic (i.e. ggml signature in hex format)
     {
         uint32_t magic;
@@ -190,6 +319,13 @@ bool encodec_load_model_weights(std::ifstream &infile, encodec_model &model, int
         return 1;
     }
 
+    // the decoder of a quantized model, see encodec_quantize_rows
+    ggml_type qtype = GGML_TYPE_COUNT;
+    if (ggml_is_quantized(wtype)) {
+        qtype = wtype;
+        wtype = GGML_TYPE_F16;
+    }
+
     auto &ctx = model.ctx;
 
     // create the ggml context
@@ -240,6 +376,12 @@ bool encodec_load_model_weights(std::ifstream &infile, encodec_model &model, int
         return false;
     }
 
+    // the packed convolutions only run on the CPU
+    if (qtype != GGML_TYPE_COUNT && !ggml_backend_is_cpu(model.backend)) {
+        fprintf(stderr, "%s: quantized models only run on the CPU backend\n", __func__);
+        return false;
+    }
+
     // create the tensors for the model
     {
         const auto & hparams = model.hparams;
@@ -259,40 +401,40 @@ bool encodec_load_model_weights(std::ifstream &infile, encodec_model &model, int
 
             int mult = 1;  // scaling factor for hidden size
 
-            model.encoder.init_conv_w = ggml_new_tensor_3d(ctx, wtype, kernel_size, in_channels, mult * n_filters);
-            model.encoder.init_conv_b = ggml_new_tensor_1d(ctx, GGML_TYPE_F32, mult * n_filters);
+            model.encoder.init_conv.w = ggml_new_tensor_3d(ctx, wtype, kernel_size, in_channels, mult * n_filters);
+            model.encoder.init_conv.b = ggml_new_tensor_1d(ctx, GGML_TYPE_F32, mult * n_filters);
 
-            model.tensors["encoder.model.0.conv.conv.weight"] = model.encoder.init_conv_w;
-            model.tensors["encoder.model.0.conv.conv.bias"] = model.encoder.init_conv_b;
+            model.tensors["encoder.model.0.conv.conv.weight"] = model.encoder.init_conv.w;
+            model.tensors["encoder.model.0.conv.conv.bias"] = model.encoder.init_conv.b;
 
             for (int i = 0; i < 4; i++) {
                 // conv1
-                model.encoder.blocks[i].conv_1_w = ggml_new_tensor_3d(ctx, wtype, res_kernel_sz, mult * n_filters, mult * n_filters / 2);
-                model.encoder.blocks[i].conv_1_b = ggml_new_tensor_1d(ctx, GGML_TYPE_F32, mult * n_filters / 2);
+                model.encoder.blocks[i].conv_1.w = ggml_new_tensor_3d(ctx, wtype, res_kernel_sz, mult * n_filters, mult * n_filters / 2);
+                model.encoder.blocks[i].conv_1.b = ggml_new_tensor_1d(ctx, GGML_TYPE_F32, mult * n_filters / 2);
 
-                model.tensors["encoder.model." + std::to_string(3 * i + 1) + ".block.1.conv.conv.weight"] = model.encoder.blocks[i].conv_1_w;
-                model.tensors["encoder.model." + std::to_string(3 * i + 1) + ".block.1.conv.conv.bias"] = model.encoder.blocks[i].conv_1_b;
+                model.tensors["encoder.model." + std::to_string(3 * i + 1) + ".block.1.conv.conv.weight"] = model.encoder.blocks[i].conv_1.w;
+                model.tensors["encoder.model." + std::to_string(3 * i + 1) + ".block.1.conv.conv.bias"] = model.encoder.blocks[i].conv_1.b;
 
                 // conv2
-                model.encoder.blocks[i].conv_2_w = ggml_new_tensor_3d(ctx, wtype, 1, mult * n_filters / 2, mult * n_filters);
-                model.encoder.blocks[i].conv_2_b = ggml_new_tensor_1d(ctx, GGML_TYPE_F32, mult * n_filters);
+                model.encoder.blocks[i].conv_2.w = ggml_new_tensor_3d(ctx, wtype, 1, mult * n_filters / 2, mult * n_filters);
+                model.encoder.blocks[i].conv_2.b = ggml_new_tensor_1d(ctx, GGML_TYPE_F32, mult * n_filters);
 
-                model.tensors["encoder.model." + std::to_string(3 * i + 1) + ".block.3.conv.conv.weight"] = model.encoder.blocks[i].conv_2_w;
-                model.tensors["encoder.model." + std::to_string(3 * i + 1) + ".block.3.conv.conv.bias"] = model.encoder.blocks[i].conv_2_b;
+                model.tensors["encoder.model." + std::to_string(3 * i + 1) + ".block.3.conv.conv.weight"] = model.encoder.blocks[i].conv_2.w;
+                model.tensors["encoder.model." + std::to_string(3 * i + 1) + ".block.3.conv.conv.bias"] = model.encoder.blocks[i].conv_2.b;
 
                 // shortcut conv
-                model.encoder.blocks[i].conv_sc_w = ggml_new_tensor_3d(ctx, wtype, 1, mult * n_filters, mult * n_filters);
-                model.encoder.blocks[i].conv_sc_b = ggml_new_tensor_1d(ctx, GGML_TYPE_F32, mult * n_filters);
+                model.encoder.blocks[i].conv_sc.w = ggml_new_tensor_3d(ctx, wtype, 1, mult * n_filters, mult * n_filters);
+                model.encoder.blocks[i].conv_sc.b = ggml_new_tensor_1d(ctx, GGML_TYPE_F32, mult * n_filters);
 
-                model.tensors["encoder.model." + std::to_string(3 * i + 1) + ".shortcut.conv.conv.weight"] = model.encoder.blocks[i].conv_sc_w;
-                model.tensors["encoder.model." + std::to_string(3 * i + 1) + ".shortcut.conv.conv.bias"] = model.encoder.blocks[i].conv_sc_b;
+                model.tensors["encoder.model." + std::to_string(3 * i + 1) + ".shortcut.conv.conv.weight"] = model.encoder.blocks[i].conv_sc.w;
+                model.tensors["encoder.model." + std::to_string(3 * i + 1) + ".shortcut.conv.conv.bias"] = model.encoder.blocks[i].conv_sc.b;
 
                 // downsampling
-                model.encoder.blocks[i].ds_conv_w = ggml_new_tensor_3d(ctx, wtype, 2 * ratios[3 - i], mult * n_filters, mult * n_filters * 2);
-                model.encoder.blocks[i].ds_conv_b = ggml_new_tensor_1d(ctx, GGML_TYPE_F32, mult * n_filters * 2);
+                model.encoder.blocks[i].ds_conv.w = ggml_new_tensor_3d(ctx, wtype, 2 * ratios[3 - i], mult * n_filters, mult * n_filters * 2);
+                model.encoder.blocks[i].ds_conv.b = ggml_new_tensor_1d(ctx, GGML_TYPE_F32, mult * n_filters * 2);
 
-                model.tensors["encoder.model." + std::to_string(3 * (i + 1)) + ".conv.conv.weight"] = model.encoder.blocks[i].ds_conv_w;
-                model.tensors["encoder.model." + std::to_string(3 * (i + 1)) + ".conv.conv.bias"] = model.encoder.blocks[i].ds_conv_b;
+                model.tensors["encoder.model." + std::to_string(3 * (i + 1)) + ".conv.conv.weight"] = model.encoder.blocks[i].ds_conv.w;
+                model.tensors["encoder.model." + std::to_string(3 * (i + 1)) + ".conv.conv.bias"] = model.encoder.blocks[i].ds_conv.b;
 
                 mult *= 2;
             }
@@ -323,11 +465,11 @@ bool encodec_load_model_weights(std::ifstream &infile, encodec_model &model, int
             model.tensors["encoder.model.13.lstm.bias_hh_l1"] = model.encoder.lstm.l1_hh_b;
 
             // final conv
-            model.encoder.final_conv_w = ggml_new_tensor_3d(ctx, wtype, kernel_size, mult * n_filters, hidden_dim);
-            model.encoder.final_conv_b = ggml_new_tensor_1d(ctx, GGML_TYPE_F32, hidden_dim);
+            model.encoder.final_conv.w = ggml_new_tensor_3d(ctx, wtype, kernel_size, mult * n_filters, hidden_dim);
+            model.encoder.final_conv.b = ggml_new_tensor_1d(ctx, GGML_TYPE_F32, hidden_dim);
 
-            model.tensors["encoder.model.15.conv.conv.weight"] = model.encoder.final_conv_w;
-            model.tensors["encoder.model.15.conv.conv.bias"] = model.encoder.final_conv_b;
+            model.tensors["encoder.model.15.conv.conv.weight"] = model.encoder.final_conv.w;
+            model.tensors["encoder.model.15.conv.conv.bias"] = model.encoder.final_conv.b;
         }
 
         // decoder
@@ -336,21 +478,36 @@ bool encodec_load_model_weights(std::ifstream &infile, encodec_model &model, int
 
             int mult = 16;  // 2**len(ratios)
 
-            model.decoder.init_conv_w = ggml_new_tensor_3d(ctx, wtype, kernel_size, hidden_dim, mult * n_filters);
-            model.decoder.init_conv_b = ggml_new_tensor_1d(ctx, GGML_TYPE_F32, mult * n_filters);
+            // weights of the convolutions, packed when they are quantized
+            auto conv_w = [&](int kernel_sz, int n_in, int n_out, int transposed_stride) {
+                if (encodec_quantize_rows(qtype, n_in) && (!transposed_stride || kernel_sz % transposed_stride == 0)) {
+                    return ggml_new_tensor_3d(ctx, qtype, n_in, kernel_sz, n_out);
+                }
+                if (transposed_stride) {
+                    return ggml_new_tensor_3d(ctx, wtype, kernel_sz, n_out, n_in);
+                }
+                return ggml_new_tensor_3d(ctx, wtype, kernel_sz, n_in, n_out);
+            };
+
+            auto lstm_w = [&](int n_in, int n_out) {
+                return ggml_new_tensor_2d(ctx, encodec_quantize_rows(qtype, n_in) ? qtype : wtype, n_in, n_out);
+            };
 
-            model.tensors["decoder.model.0.conv.conv.weight"] = model.decoder.init_conv_w;
-            model.tensors["decoder.model.0.conv.conv.bias"] = model.decoder.init_conv_b;
+            model.decoder.init_conv.w = conv_w(kernel_size, hidden_dim, mult * n_filters, 0);
+            model.decoder.init_conv.b = ggml_new_tensor_1d(ctx, GGML_TYPE_F32, mult * n_filters);
+
+            model.tensors["decoder.model.0.conv.conv.weight"] = model.decoder.init_conv.w;
+            model.tensors["decoder.model.0.conv.conv.bias"] = model.decoder.init_conv.b;
 
             // LSTM
-            model.decoder.lstm.l0_ih_w = ggml_new_tensor_2d(ctx, wtype, mult * n_filters, 4 * mult * n_filters);
-            model.decoder.lstm.l1_ih_w = ggml_new_tensor_2d(ctx, wtype, mult * n_filters, 4 * mult * n_filters);
+            model.decoder.lstm.l0_ih_w = lstm_w(mult * n_filters, 4 * mult * n_filters);
+            model.decoder.lstm.l1_ih_w = lstm_w(mult * n_filters, 4 * mult * n_filters);
 
             model.tensors["decoder.model.1.lstm.weight_ih_l0"] = model.decoder.lstm.l0_ih_w;
             model.tensors["decoder.model.1.lstm.weight_ih_l1"] = model.decoder.lstm.l1_ih_w;
 
-            model.decoder.lstm.l0_hh_w = ggml_new_tensor_2d(ctx, wtype, mult * n_filters, 4 * mult * n_filters);
-            model.decoder.lstm.l1_hh_w = ggml_new_tensor_2d(ctx, wtype, mult * n_filters, 4 * mult * n_filters);
+            model.decoder.lstm.l0_hh_w = lstm_w(mult * n_filters, 4 * mult * n_filters);
+            model.decoder.lstm.l1_hh_w = lstm_w(mult * n_filters, 4 * mult * n_filters);
 
             model.tensors["decoder.model.1.lstm.weight_hh_l0"] = model.decoder.lstm.l0_hh_w;
             model.tensors["decoder.model.1.lstm.weight_hh_l1"] = model.decoder.lstm.l1_hh_w;
@@ -369,41 +526,41 @@ bool encodec_load_model_weights(std::ifstream &infile, encodec_model &model, int
 
             for (int i = 0; i < 4; i++) {
                 // upsampling
-                model.decoder.blocks[i].us_conv_w = ggml_new_tensor_3d(ctx, wtype, ratios[i] * 2, mult * n_filters / 2, mult * n_filters);
-                model.decoder.blocks[i].us_conv_b = ggml_new_tensor_1d(ctx, GGML_TYPE_F32, mult * n_filters / 2);
+                model.decoder.blocks[i].us_conv.w = conv_w(ratios[i] * 2, mult * n_filters, mult * n_filters / 2, ratios[i]);
+                model.decoder.blocks[i].us_conv.b = ggml_new_tensor_1d(ctx, GGML_TYPE_F32, mult * n_filters / 2);
 
-                model.tensors["decoder.model." + std::to_string(3 * (i + 1)) + ".convtr.convtr.weight"] = model.decoder.blocks[i].us_conv_w;
-                model.tensors["decoder.model." + std::to_string(3 * (i + 1)) + ".convtr.convtr.bias"] = model.decoder.blocks[i].us_conv_b;
+                model.tensors["decoder.model." + std::to_string(3 * (i + 1)) + ".convtr.convtr.weight"] = model.decoder.blocks[i].us_conv.w;
+                model.tensors["decoder.model." + std::to_string(3 * (i + 1)) + ".convtr.convtr.bias"] = model.decoder.blocks[i].us_conv.b;
 
                 // conv1
-                model.decoder.blocks[i].conv_1_w = ggml_new_tensor_3d(ctx, wtype, res_kernel_sz, mult * n_filters / 2, mult * n_filters / 4);
-                model.decoder.blocks[i].conv_1_b = ggml_new_tensor_1d(ctx, GGML_TYPE_F32, mult * n_filters / 4);
+                model.decoder.blocks[i].conv_1.w = conv_w(res_kernel_sz, mult * n_filters / 2, mult * n_filters / 4, 0);
+                model.decoder.blocks[i].conv_1.b = ggml_new_tensor_1d(ctx, GGML_TYPE_F32, mult * n_filters / 4);
 
-                model.tensors["decoder.model." + std::to_string(3 * (i + 1) + 1) + ".block.1.conv.conv.weight"] = model.decoder.blocks[i].conv_1_w;
-                model.tensors["decoder.model." + std::to_string(3 * (i + 1) + 1) + ".block.1.conv.conv.bias"] = model.decoder.blocks[i].conv_1_b;
+                model.tensors["decoder.model." + std::to_string(3 * (i + 1) + 1) + ".block.1.conv.conv.weight"] = model.decoder.blocks[i].conv_1.w;
+                model.tensors["decoder.model." + std::to_string(3 * (i + 1) + 1) + ".block.1.conv.conv.bias"] = model.decoder.blocks[i].conv_1.b;
 
                 // conv2
-                model.decoder.blocks[i].conv_2_w = ggml_new_tensor_3d(ctx, wtype, 1, mult * n_filters / 4, mult * n_filters / 2);
-                model.decoder.blocks[i].conv_2_b = ggml_new_tensor_1d(ctx, GGML_TYPE_F32, mult * n_filters / 2);
+                model.decoder.blocks[i].conv_2.w = conv_w(1, mult * n_filters / 4, mult * n_filters / 2, 0);
+                model.decoder.blocks[i].conv_2.b = ggml_new_tensor_1d(ctx, GGML_TYPE_F32, mult * n_filters / 2);
 
-                model.tensors["decoder.model." + std::to_string(3 * (i + 1) + 1) + ".block.3.conv.conv.weight"] = model.decoder.blocks[i].conv_2_w;
-                model.tensors["decoder.model." + std::to_string(3 * (i + 1) + 1) + ".block.3.conv.conv.bias"] = model.decoder.blocks[i].conv_2_b;
+                model.tensors["decoder.model." + std::to_string(3 * (i + 1) + 1) + ".block.3.conv.conv.weight"] = model.decoder.blocks[i].conv_2.w;
+                model.tensors["decoder.model." + std::to_string(3 * (i + 1) + 1) + ".block.3.conv.conv.bias"] = model.decoder.blocks[i].conv_2.b;
 
                 // shortcut
-                model.decoder.blocks[i].conv_sc_w = ggml_new_tensor_3d(ctx, wtype, 1, mult * n_filters / 2, mult * n_filters / 2);
-                model.decoder.blocks[i].conv_sc_b = ggml_new_tensor_1d(ctx, GGML_TYPE_F32, mult * n_filters / 2);
+                model.decoder.blocks[i].conv_sc.w = conv_w(1, mult * n_filters / 2, mult * n_filters / 2, 0);
+                model.decoder.blocks[i].conv_sc.b = ggml_new_tensor_1d(ctx, GGML_TYPE_F32, mult * n_filters / 2);
 
-                model.tensors["decoder.model." + std::to_string(3 * (i + 1) + 1) + ".shortcut.conv.conv.weight"] = model.decoder.blocks[i].conv_sc_w;
-                model.tensors["decoder.model." + std::to_string(3 * (i + 1) + 1) + ".shortcut.conv.conv.bias"] = model.decoder.blocks[i].conv_sc_b;
+                model.tensors["decoder.model." + std::to_string(3 * (i + 1) + 1) + ".shortcut.conv.conv.weight"] = model.decoder.blocks[i].conv_sc.w;
+                model.tensors["decoder.model." + std::to_string(3 * (i + 1) + 1) + ".shortcut.conv.conv.bias"] = model.decoder.blocks[i].conv_sc.b;
 
                 mult /= 2;
             }
 
-            model.decoder.final_conv_w = ggml_new_tensor_3d(ctx, wtype, kernel_size, n_filters, in_channels);
-            model.decoder.final_conv_b = ggml_new_tensor_1d(ctx, GGML_TYPE_F32, in_channels);
+            model.decoder.final_conv.w = conv_w(kernel_size, n_filters, in_channels, 0);
+            model.decoder.final_conv.b = ggml_new_tensor_1d(ctx, GGML_TYPE_F32, in_channels);
 
-            model.tensors["decoder.model.15.conv.conv.weight"] = model.decoder.final_conv_w;
-            model.tensors["decoder.model.15.conv.conv.bias"] = model.decoder.final_conv_b;
+            model.tensors["decoder.model.15.conv.conv.weight"] = model.decoder.final_conv.w;
+            model.tensors["decoder.model.15.conv.conv.bias"] = model.decoder.final_conv.b;
         }
 
         // quantizer
@@ -418,8 +575,28 @@ bool encodec_load_model_weights(std::ifstream &infile, encodec_model &model, int
         }
     }
 
-    // allocate the model tensors in a backend buffer
-    model.buffer_w = ggml_backend_alloc_ctx_tensors(ctx, model.backend);
+    // use the weights in place when they are in memory and stay on the CPU, the others are
+    // allocated in a backend buffer once all the tensors have been seen
+    const bool use_mapping = infile.data && ggml_backend_is_cpu(model.backend);
+
+    if (use_mapping) {
+        model.buffer_mapped = ggml_backend_cpu_buffer_from_ptr((void *) infile.data, infile.size);
+    } else {
+        model.buffer_w = ggml_backend_alloc_ctx_tensors(ctx, model.backend);
+    }
+
+    // tensors to copy from memory, with the offset of their data
+    std::vector<std::pair<struct ggml_tensor *, size_t>> copied;
+
+    // the convolution weights packed by encodec_pack_conv_weights are copied, to be packed in place
+    std::set<const struct ggml_tensor *> repacked;
+    if (use_mapping) {
+        for (const auto &layer : encodec_conv_layers(model)) {
+            if (encodec_conv_repacked(layer)) {
+                repacked.insert(layer.conv->w);
+            }
+        }
+    }
 
     // load weights
     {
@@ -451,7 +628,7 @@ bool encodec_load_model_weights(std::ifstream &infile, encodec_model &model, int
             std::string name;
             std::vector<char> buf(length);
             infile.read(&buf[0], buf.size());
-            name.assign(&buf[0], buf.size());
+            name.assign(&buf[0], strnlen(&buf[0], buf.size())); // names may be padded with zeros to align the data
 
             if (model.tensors.find(name.data()) == model.tensors.end()) {
                 fprintf(stderr, "%s: unknown tensor '%s' in model file\n", __func__, name.data());
@@ -479,7 +656,21 @@ bool encodec_load_model_weights(std::ifstream &infile, encodec_model &model, int
                 return false;
             }
 
-            if (ggml_backend_buffer_is_host(model.buffer_w)) {
+            if (use_mapping) {
+                if (infile.pos + ggml_nbytes(tensor) > infile.size) {
+                    fprintf(stderr, "%s: tensor '%s' is truncated in model file\n", __func__, name.data());
+                    return false;
+                }
+
+                if (ftype == tensor->type && infile.pos % ggml_backend_buffer_get_alignment(model.buffer_mapped) == 0 &&
+                    !repacked.count(tensor)) {
+                    ggml_backend_tensor_alloc(model.buffer_mapped, tensor, (void *) (infile.data + infile.pos));
+                } else {
+                    copied.push_back({tensor, infile.pos});
+                }
+
+                infile.pos += ggml_nbytes(tensor);
+            } else if (ggml_backend_buffer_is_host(model.buffer_w)) {
                 // for some backends such as CPU and Metal, the tensor data is in system memory and we can read directly into it
                 infile.read(reinterpret_cast<char *>(tensor->data), ggml_nbytes(tensor));
             } else {
@@ -493,6 +684,24 @@ bool encodec_load_model_weights(std::ifstream &infile, encodec_model &model, int
             model.n_loaded++;
         }
 
+        // unaligned and repacked tensors, and any tensor not in the file, get their own buffer
+        bool all_mapped = true;
+        for (struct ggml_tensor *t = ggml_get_first_tensor(ctx); t; t = ggml_get_next_tensor(ctx, t)) {
+            all_mapped &= t->data != NULL;
+        }
+
+        if (!all_mapped) {
+            model.buffer_w = ggml_backend_alloc_ctx_tensors(ctx, model.backend);
+            if (!model.buffer_w) {
+                fprintf(stderr, "%s: failed to allocate the weights\n", __func__);
+                return false;
+            }
+
+            for (auto &c : copied) {
+                ggml_backend_tensor_set(c.first, infile.data + c.second, 0, ggml_nbytes(c.first));
+            }
+        }
+
         printf("%s: model size = %.2f MB\n", __func__, total_size / 1024.0 / 1024.0);
     }
 
@@ -501,53 +710,24 @@ bool encodec_load_model_weights(std::ifstream &infile, encodec_model &model, int
     return true;
 }
 
-// Create a new ggml_cgraph with the given size (usually ENCODEC_MAX_NODES). We need a
-// custom function since the graph is so large, it overpasses the max built-in ggml
-// default size.
-static struct ggml_cgraph * encodec_ggml_cgraph_create(size_t size) {
-    struct ggml_cgraph * cgraph = (struct ggml_cgraph *)calloc(1, sizeof(struct ggml_cgraph));
-    cgraph->size = size;
-    cgraph->n_nodes = 0;
-    cgraph->n_leafs = 0;
-    cgraph->nodes = (struct ggml_tensor **)calloc(1, size * sizeof(struct ggml_tensor *));
-    cgraph->leafs = (struct ggml_tensor **)calloc(1, size * sizeof(struct ggml_tensor *));
-
-    // next primes after powers of two
-    static const size_t primes[] = {
-        2, 3, 5, 11, 17, 37, 67, 131, 257, 521, 1031,
-        2053, 4099, 8209, 16411, 32771, 65537, 131101,
-        262147, 524309, 1048583, 2097169, 4194319, 8388617,
-        16777259, 33554467, 67108879, 134217757, 268435459,
-        536870923, 1073741827, 2147483659
-    };
-    static const size_t n_primes = sizeof(primes)/sizeof(primes[0]);
-
-    // find the smallest prime that is larger or equal to size
-    size_t l = 0;
-    size_t r = n_primes;
-    while (l < r) {
-        size_t m = (l + r)/2;
-        if (primes[m] < size * 2) {
-            l = m + 1;
-        } else {
-            r = m;
-        }
+// The graph has the fused size only if every LSTM layer it runs is fused, an unrolled layer
+// grows with the length of the audio
+static size_t encodec_max_nodes(const encodec_model & model, bool encoder, bool decoder) {
+    if (encoder && !encodec_lstm_use_fused(model.encoder.lstm)) {
+        return ENCODEC_MAX_NODES;
     }
-    size_t hash_size = l < n_primes ? primes[l] : (size * 2 + 1);
-
-    cgraph->visited_hash_set.size = hash_size;
-    cgraph->visited_hash_set.keys = (struct ggml_tensor **)calloc(1, hash_size * sizeof(struct ggml_tensor *));
-    cgraph->visited_hash_set.used = (ggml_bitset_t *)calloc(1, ggml_bitset_size(hash_size) * sizeof(ggml_bitset_t));
-    cgraph->order = GGML_CGRAPH_EVAL_ORDER_LEFT_TO_RIGHT;
-
-    return cgraph;
+    if (decoder && !encodec_lstm_use_fused(model.decoder.lstm)) {
+        return ENCODEC_MAX_NODES;
+    }
+    return ENCODEC_MAX_NODES_FUSED;
 }
 
 void encodec_build_graph(struct encodec_context *ectx,
                          const float * inp_audio,
                          const int n_samples,
                          const encodec_run_mode_t mode) {
-    assert(mode == encodec_run_mode_t::FULL || mode == encodec_run_mode_t::ENCODE);
+    assert(mode == encodec_run_mode_t::FULL || mode == encodec_run_mode_t::ENCODE ||
+           mode == encodec_run_mode_t::ENCODE_STREAM);
 
     const auto & model   = ectx->model;
     const auto & hparams = model.hparams;
@@ -568,8 +748,11 @@ void encodec_build_graph(struct encodec_context *ectx,
 
     // since we are using ggml-alloc, this buffer only needs enough space to hold the
     // ggml_tensor and ggml_cgraph structs, but not the tensor data
-    static size_t buf_size = ggml_tensor_overhead() * ENCODEC_MAX_NODES + ggml_graph_overhead();
-    static std::vector<uint8_t> buf(buf_size);
+    const size_t max_nodes = encodec_max_nodes(model, true, mode == encodec_run_mode_t::FULL);
+
+    size_t buf_size = ggml_tensor_overhead() * max_nodes + ggml_graph_overhead_custom(max_nodes, false);
+    auto & buf = ectx->buf_graph;
+    buf.resize(buf_size);
 
     struct ggml_init_params ggml_params = {
         /*.mem_size   =*/ buf_size,
@@ -579,7 +762,7 @@ void encodec_build_graph(struct encodec_context *ectx,
 
     struct ggml_context *ctx0 = ggml_init(ggml_params);
 
-    gf = std::unique_ptr<struct ggml_cgraph, encodec_ggml_cgraph_deleter>(encodec_ggml_cgraph_create(ENCODEC_MAX_NODES));
+    gf = ggml_new_graph_custom(ctx0, max_nodes, false);
 
     struct ggml_tensor *inp = ggml_new_tensor_1d(ctx0, GGML_TYPE_F32, n_samples);
     ggml_set_name(inp, "inp");
@@ -589,8 +772,16 @@ void encodec_build_graph(struct encodec_context *ectx,
     const struct encodec_quantizer * quantizer = &model.quantizer;
     const struct encodec_decoder   * decoder   = &model.decoder;
 
+    // the states of the stream are added in the order of the layers
+    encodec_stream * stream = NULL;
+    if (mode == encodec_run_mode_t::ENCODE_STREAM) {
+        stream = &ectx->encode_stream;
+        stream->inputs.clear();
+        stream->outputs.clear();
+    }
+
     struct ggml_tensor * encoded = encodec_forward_encoder(
-        encoder, ctx0, inp, ratios, kernel_size, res_kernel_sz, stride);
+        encoder, ctx0, inp, ratios, kernel_size, res_kernel_sz, stride, stream);
 
     struct ggml_tensor * codes = encodec_forward_quantizer_encode(
         quantizer, ctx0, encoded, n_bins, sr, bandwidth, hop_length);
@@ -599,18 +790,26 @@ void encodec_build_graph(struct encodec_context *ectx,
         quantizer, ctx0, codes, hidden_dim, n_bins, sr, bandwidth, hop_length);
 
     struct ggml_tensor * decoded = encodec_forward_decoder(
-        decoder, ctx0, quantized, ratios, kernel_size, res_kernel_sz, stride);
+        decoder, ctx0, quantized, ratios, kernel_size, res_kernel_sz, stride, NULL);
 
     switch (mode) {
         case encodec_run_mode_t::FULL: {
             ggml_set_name(decoded, "decoded");
             ggml_set_output(decoded);
-            ggml_build_forward_expand(gf.get(), decoded);
+            ggml_build_forward_expand(gf, decoded);
         } break;
-        case encodec_run_mode_t::ENCODE: {
+        case encodec_run_mode_t::ENCODE:
+        case encodec_run_mode_t::ENCODE_STREAM: {
             ggml_set_name(codes, "codes");
             ggml_set_output(codes);
-            ggml_build_forward_expand(gf.get(), codes);
+            ggml_build_forward_expand(gf, codes);
+
+            // the states for the next chunk are not needed by the codes
+            if (stream) {
+                for (auto * state : stream->outputs) {
+                    ggml_build_forward_expand(gf, state);
+                }
+            }
         } break;
         case encodec_run_mode_t::DECODE: {
             assert(false);
@@ -629,7 +828,7 @@ void encodec_build_graph(struct encodec_context *ectx,
 
 void encodec_build_graph(struct encodec_context *ectx, const int32_t *codes,
                          const int n_codes, const encodec_run_mode_t mode) {
-    assert(mode == encodec_run_mode_t::DECODE);
+    assert(mode == encodec_run_mode_t::DECODE || mode == encodec_run_mode_t::DECODE_STREAM);
 
     const auto & model   = ectx->model;
     const auto & hparams = model.hparams;
@@ -656,8 +855,11 @@ void encodec_build_graph(struct encodec_context *ectx, const int32_t *codes,
 
     const int N = n_codes / n_q;
 
-    static size_t buf_size = ggml_tensor_overhead() * ENCODEC_MAX_NODES + ggml_graph_overhead();
-    static std::vector<uint8_t> buf(buf_size);
+    const size_t max_nodes = encodec_max_nodes(model, false, true);
+
+    size_t buf_size = ggml_tensor_overhead() * max_nodes + ggml_graph_overhead_custom(max_nodes, false);
+    auto & buf = ectx->buf_graph;
+    buf.resize(buf_size);
 
     struct ggml_init_params ggml_params = {
         /*.mem_size   =*/ buf_size,
@@ -667,7 +869,7 @@ void encodec_build_graph(struct encodec_context *ectx, const int32_t *codes,
 
     struct ggml_context *ctx0 = ggml_init(ggml_params);
 
-    gf = std::unique_ptr<struct ggml_cgraph, encodec_ggml_cgraph_deleter>(encodec_ggml_cgraph_create(ENCODEC_MAX_NODES));
+    gf = ggml_new_graph_custom(ctx0, max_nodes, false);
 
     struct ggml_tensor *inp_codes = ggml_new_tensor_2d(ctx0, GGML_TYPE_I32, N, n_q);
     ggml_set_name(inp_codes, "inp_codes");
@@ -680,15 +882,31 @@ void encodec_build_graph(struct encodec_context *ectx, const int32_t *codes,
         quantizer, ctx0, inp_codes, hidden_dim, n_bins, sr, bandwidth, hop_length
     );
 
+    // the states of the stream are added in the order of the layers
+    encodec_stream * stream = NULL;
+    if (mode == encodec_run_mode_t::DECODE_STREAM) {
+        stream = &ectx->stream;
+        stream->inputs.clear();
+        stream->outputs.clear();
+    }
+
     struct ggml_tensor *decoded = encodec_forward_decoder(
-        decoder, ctx0, quantized, ratios, kernel_size, res_kernel_sz, stride
+        decoder, ctx0, quantized, ratios, kernel_size, res_kernel_sz, stride, stream
     );
 
     switch (mode) {
-        case encodec_run_mode_t::DECODE: {
+        case encodec_run_mode_t::DECODE:
+        case encodec_run_mode_t::DECODE_STREAM: {
             ggml_set_name(decoded, "decoded");
             ggml_set_output(decoded);
-            ggml_build_forward_expand(gf.get(), decoded);
+            ggml_build_forward_expand(gf, decoded);
+
+            // the states for the next chunk are not needed by the audio
+            if (stream) {
+                for (auto * state : stream->outputs) {
+                    ggml_build_forward_expand(gf, state);
+                }
+            }
         } break;
         default: {
             fprintf(stderr, "%s: unknown run mode\n", __func__);
@@ -702,41 +920,122 @@ void encodec_build_graph(struct encodec_context *ectx, const int32_t *codes,
     ectx->decoded = decoded;
 }
 
+// zeroes an input of the graph, if the graph has it
 static void encodec_zero_tensor(struct ggml_cgraph *gf, const char *name) {
     struct ggml_tensor *tensor = ggml_graph_get_tensor(gf, name);
-    ggml_set_zero(tensor);
+    if (tensor) {
+        ggml_set_zero(tensor);
+    }
+}
+
+// Rounds the number of frames up to a multiple of 8, or to one of four sizes per power of
+// two above 64 frames, so that decoding texts of similar lengths reuses the same graph
+// while at most 7 frames or a fifth of the frames are padding.
+static int encodec_graph_frames(const int n_frames) {
+    int step = 8;
+    while (step * 8 < n_frames) {
+        step *= 2;
+    }
+    return (n_frames + step - 1) / step * step;
+}
+
+// Returns true if the graph of the last run can be run again, otherwise records the shape
+// of the graph that is about to be built.
+static bool encodec_reuse_graph(struct encodec_context *ectx, const int length,
+                                const encodec_run_mode_t mode) {
+    const bool started = (mode == encodec_run_mode_t::DECODE_STREAM && ectx->stream.started) ||
+                         (mode == encodec_run_mode_t::ENCODE_STREAM && ectx->encode_stream.started);
+
+    if (ectx->gf && ectx->graph_mode == mode && ectx->graph_length == length &&
+        ectx->graph_bandwidth == ectx->model.hparams.bandwidth && ectx->graph_started == started) {
+        return true;
+    }
+
+    ectx->graph_mode      = mode;
+    ectx->graph_length    = length;
+    ectx->graph_bandwidth = ectx->model.hparams.bandwidth;
+    ectx->graph_started   = started;
+
+    return false;
+}
+
+static bool encodec_alloc_graph(struct encodec_context *ectx) {
+    if (!ectx->allocr) {
+        // create a graph allocator with the backend's default buffer type
+        ectx->allocr = ggml_gallocr_new(ggml_backend_get_default_buffer_type(ectx->model.backend));
+    }
+
+    // the compute buffer is only reallocated when the graph needs more memory
+    const size_t mem_size = ggml_gallocr_get_buffer_size(ectx->allocr, 0);
+
+    if (!ggml_gallocr_alloc_graph(ectx->allocr, ectx->gf)) {
+        fprintf(stderr, "%s: failed to allocate the compute buffer\n", __func__);
+        ectx->gf = nullptr;
+        return false;
+    }
+
+    const size_t new_mem_size = ggml_gallocr_get_buffer_size(ectx->allocr, 0);
+    if (new_mem_size != mem_size) {
+        fprintf(stderr, "%s: compute buffer size = %.2f MB\n", __func__, new_mem_size / 1024.0 / 1024.0);
+    }
+
+    return true;
+}
+
+// sets the states saved by the previous chunk of a stream as inputs of the graph
+static void encodec_stream_set_states(struct encodec_stream &stream) {
+    for (size_t i = 0; i < stream.inputs.size(); i++) {
+        if (stream.inputs[i]) {
+            ggml_backend_tensor_set(stream.inputs[i], stream.states[i].data(), 0, stream.states[i].size() * sizeof(float));
+        }
+    }
+}
+
+// saves the states computed by the graph for the next chunk of a stream
+static void encodec_stream_save_states(struct encodec_stream &stream) {
+    stream.states.resize(stream.outputs.size());
+    for (size_t i = 0; i < stream.outputs.size(); i++) {
+        stream.states[i].resize(ggml_nelements(stream.outputs[i]));
+        ggml_backend_tensor_get(stream.outputs[i], stream.states[i].data(), 0, ggml_nbytes(stream.outputs[i]));
+    }
+    stream.started = true;
 }
 
 bool encodec_eval_internal(struct encodec_context *ectx, const float * raw_audio,
                            const int n_samples, const int n_threads,
                            const encodec_run_mode_t mode) {
-    assert(mode == encodec_run_mode_t::FULL || mode == encodec_run_mode_t::ENCODE);
+    assert(mode == encodec_run_mode_t::FULL || mode == encodec_run_mode_t::ENCODE ||
+           mode == encodec_run_mode_t::ENCODE_STREAM);
     auto & model  = ectx->model;
-    auto & allocr = ectx->allocr;
     auto & gf     = ectx->gf;
 
-    encodec_build_graph(ectx, raw_audio, n_samples, mode);
+    if (!encodec_reuse_graph(ectx, n_samples, mode)) {
+        encodec_build_graph(ectx, raw_audio, n_samples, mode);
 
-    // allocate the graph tensors
-    ggml_gallocr_alloc_graph(allocr, gf.get());
+        // allocate the graph tensors
+        if (!encodec_alloc_graph(ectx)) {
+            return false;
+        }
+    }
 
     // set the graph inputs
-    struct ggml_tensor * inp = ggml_graph_get_tensor(gf.get(), "inp");
+    struct ggml_tensor * inp = ggml_graph_get_tensor(gf, "inp");
     ggml_backend_tensor_set(inp, raw_audio, 0, n_samples * ggml_element_size(inp));
 
     // make sure accumulation tensor are zeroed
-    encodec_zero_tensor(gf.get(), "enc_l0_ht");
-    encodec_zero_tensor(gf.get(), "enc_l1_ht");
-    encodec_zero_tensor(gf.get(), "enc_l0_ct");
-    encodec_zero_tensor(gf.get(), "enc_l1_ct");
+    encodec_zero_tensor(gf, "enc_l0_state");
+    encodec_zero_tensor(gf, "enc_l1_state");
 
     if (mode == encodec_run_mode_t::FULL) {
-        encodec_zero_tensor(gf.get(), "dec_l0_ht");
-        encodec_zero_tensor(gf.get(), "dec_l1_ht");
-        encodec_zero_tensor(gf.get(), "dec_l0_ct");
-        encodec_zero_tensor(gf.get(), "dec_l1_ct");
+        encodec_zero_tensor(gf, "dec_l0_state");
+        encodec_zero_tensor(gf, "dec_l1_state");
+
+        encodec_zero_tensor(gf, "quantized_out");
+    }
 
-        encodec_zero_tensor(gf.get(), "quantized_out");
+    // continue from the states of the previous chunk
+    if (mode == encodec_run_mode_t::ENCODE_STREAM) {
+        encodec_stream_set_states(ectx->encode_stream);
     }
 
     // run the computation
@@ -744,7 +1043,12 @@ bool encodec_eval_internal(struct encodec_context *ectx, const float * raw_audio
         ggml_backend_cpu_set_n_threads(model.backend, n_threads);
     }
 
-    ggml_backend_graph_compute(model.backend, gf.get());
+    ggml_backend_graph_compute(model.backend, gf);
+
+    // save the states for the next chunk
+    if (mode == encodec_run_mode_t::ENCODE_STREAM) {
+        encodec_stream_save_states(ectx->encode_stream);
+    }
 
     return true;
 }
@@ -752,37 +1056,80 @@ bool encodec_eval_internal(struct encodec_context *ectx, const float * raw_audio
 bool encodec_eval_internal(struct encodec_context *ectx, const int32_t *codes,
                            const int n_codes, const int n_threads,
                            const encodec_run_mode_t mode) {
-    assert(mode == encodec_run_mode_t::DECODE);
+    assert(mode == encodec_run_mode_t::DECODE || mode == encodec_run_mode_t::DECODE_STREAM);
+
+    const auto & hparams = ectx->model.hparams;
 
     auto & model  = ectx->model;
-    auto & allocr = ectx->allocr;
     auto & gf     = ectx->gf;
 
-    encodec_build_graph(ectx, codes, n_codes, mode);
+    const int frame_rate = (int)ceilf(hparams.sr / hparams.hop_length);
+    const int n_q = get_num_quantizers_for_bandwidth(hparams.n_bins, frame_rate, hparams.bandwidth);
 
-    // allocate the graph tensors
-    ggml_gallocr_alloc_graph(allocr, gf.get());
+    if (n_codes % n_q != 0) {
+        fprintf(stderr, "%s: invalid number of codes\n", __func__);
+        return false;
+    }
+
+    for (int i = 0; i < n_codes; i++) {
+        if (codes[i] < 0 || codes[i] >= hparams.n_bins) {
+            fprintf(stderr, "%s: invalid code %d, the codebooks have %d codes\n", __func__, codes[i], hparams.n_bins);
+            return false;
+        }
+    }
+
+    // the decoder is causal, so the frames padded at the end do not change the audio of the
+    // others, but the states of a stream must come from its last frame. Inputs no longer than
+    // the padding of the first convolution are reflected into the zeros that extend them, the
+    // padded frames would be reflected instead, so they are not padded.
+    const int n_frames = n_codes / n_q;
+    const bool padded = mode == encodec_run_mode_t::DECODE && n_frames >= hparams.kernel_size;
+    const int n_graph_frames = padded ? encodec_graph_frames(n_frames) : n_frames;
+
+    if (!encodec_reuse_graph(ectx, n_graph_frames, mode)) {
+        encodec_build_graph(ectx, codes, n_graph_frames * n_q, mode);
+
+        // allocate the graph tensors
+        if (!encodec_alloc_graph(ectx)) {
+            return false;
+        }
+    }
 
     // set the graph inputs
-    struct ggml_tensor * inp = ggml_graph_get_tensor(gf.get(), "inp_codes");
-    ggml_backend_tensor_set(inp, codes, 0, n_codes * ggml_element_size(inp));
+    struct ggml_tensor * inp = ggml_graph_get_tensor(gf, "inp_codes");
+    if (n_graph_frames == n_frames) {
+        ggml_backend_tensor_set(inp, codes, 0, n_codes * ggml_element_size(inp));
+    } else {
+        auto & inp_codes = ectx->inp_codes;
+        inp_codes.assign(n_graph_frames * n_q, 0);
+        for (int q = 0; q < n_q; q++) {
+            std::copy_n(codes + q * n_frames, n_frames, inp_codes.data() + q * n_graph_frames);
+        }
+        ggml_backend_tensor_set(inp, inp_codes.data(), 0, inp_codes.size() * ggml_element_size(inp));
+    }
 
     // make sure accumulation tensors are zeroed
-    encodec_zero_tensor(gf.get(), "dec_l0_ht");
-    encodec_zero_tensor(gf.get(), "dec_l1_ht");
-    encodec_zero_tensor(gf.get(), "dec_l0_ct");
-    encodec_zero_tensor(gf.get(), "dec_l1_ct");
+    encodec_zero_tensor(gf, "dec_l0_state");
+    encodec_zero_tensor(gf, "dec_l1_state");
+
+    encodec_zero_tensor(gf, "quantized_out");
 
-    encodec_zero_tensor(gf.get(), "quantized_out");
+    // continue from the states of the previous chunk
+    if (mode == encodec_run_mode_t::DECODE_STREAM) {
+        encodec_stream_set_states(ectx->stream);
+    }
 
     // run the computation
     if (ggml_backend_is_cpu(model.backend)) {
         ggml_backend_cpu_set_n_threads(model.backend, n_threads);
     }
 
-    printf("Computing...\n");
-    ggml_backend_graph_compute(model.backend, gf.get());
-    printf("Done computing.\n");
+    ggml_backend_graph_compute(model.backend, gf);
+
+    // save the states for the next chunk
+    if (mode == encodec_run_mode_t::DECODE_STREAM) {
+        encodec_stream_save_states(ectx->stream);
+    }
 
     return true;
 }
@@ -792,20 +1139,6 @@ bool encodec_eval(struct encodec_context *ectx, const float *raw_audio,
                   const encodec_run_mode_t mode) {
     const int64_t t_start_us = ggml_time_us();
 
-    // allocate the compute buffer
-    {
-        // create a graph allocator with the backend's default buffer type
-        ectx->allocr = ggml_gallocr_new(ggml_backend_get_default_buffer_type(ectx->model.backend));
-
-        // create the graph for memory usage estimation
-        encodec_build_graph(ectx, raw_audio, n_samples, mode);
-
-        // pre-allocate the compute buffer
-        ggml_gallocr_reserve(ectx->allocr, ectx->gf.get());
-        size_t mem_size = ggml_gallocr_get_buffer_size(ectx->allocr, 0);
-        fprintf(stderr, "%s: compute buffer size is totally: %.2f MB\n\n", __func__, mem_size / 1024.0 / 1024.0);
-    }
-
     // encodec eval
     if (!encodec_eval_internal(ectx, raw_audio, n_samples, n_threads, mode)) {
         fprintf(stderr, "%s: failed to run encodec eval\n", __func__);
@@ -820,31 +1153,15 @@ bool encodec_eval(struct encodec_context *ectx, const float *raw_audio,
 bool encodec_eval(struct encodec_context *ectx, const int32_t *codes,
                   const int n_codes, const int n_threads,
                   const encodec_run_mode_t mode) {
-    const int64_t t_start_ms = ggml_time_us();
-
-    // allocate the compute buffer
-    {
-        // create a graph allocator with the backend's default buffer type
-        ectx->allocr = ggml_gallocr_new(ggml_backend_get_default_buffer_type(ectx->model.backend));
-
-        // create the graph for memory usage estimation
-        encodec_build_graph(ectx, codes, n_codes, mode);
-
-        // pre-allocate the compute buffer
-        ggml_gallocr_reserve(ectx->allocr, ectx->gf.get());
-        size_t mem_size = ggml_gallocr_get_buffer_size(ectx->allocr, 0);
-        fprintf(stderr, "%s: compute buffer size is totally...: %.2f MB\n\n", __func__, mem_size / 1024.0 / 1024.0);
-    }
+    const int64_t t_start_us = ggml_time_us();
 
     // encodec eval
-    fprintf(stderr, "going in for the eval\n");
     if (!encodec_eval_internal(ectx, codes, n_codes, n_threads, mode)) {
         fprintf(stderr, "%s: failed to run encodec eval\n", __func__);
         return false;
     }
-    fprintf(stderr, "done for the eval\n");
 
-    ectx->stats.t_compute_us = ggml_time_us() - t_start_ms;
+    ectx->stats.t_compute_us = ggml_time_us() - t_start_us;
 
     return true;
 }
@@ -902,6 +1219,45 @@ bool encodec_compress_audio(struct encodec_context *ectx, const float *raw_audio
     return true;
 }
 
+bool encodec_compress_audio_stream(struct encodec_context *ectx, const float *raw_audio,
+                                   const int n_samples, const int n_threads) {
+    const auto & hparams = ectx->model.hparams;
+
+    // the strided convolutions only continue a chunk that ends on a frame
+    if (n_samples % hparams.hop_length != 0) {
+        fprintf(stderr, "%s: the chunk has %d samples, not a multiple of %d\n", __func__, n_samples, hparams.hop_length);
+        return false;
+    }
+
+    if (n_samples == 0) {
+        ectx->out_codes.clear();
+        return true;
+    }
+
+    // the first chunk is padded by reflection, which needs more frames than the padding, so a
+    // shorter first chunk is compressed on its own and the stream starts with the next one
+    encodec_run_mode_t mode = encodec_run_mode_t::ENCODE_STREAM;
+    if (!ectx->encode_stream.started && n_samples / hparams.hop_length < hparams.kernel_size) {
+        mode = encodec_run_mode_t::ENCODE;
+    }
+
+    if (!encodec_eval(ectx, raw_audio, n_samples, n_threads, mode)) {
+        fprintf(stderr, "%s: failed to run encodec eval\n", __func__);
+        return false;
+    }
+
+    struct ggml_tensor *codes = ectx->codes;
+
+    auto &out_codes = ectx->out_codes;
+
+    int out_length = codes->ne[0] * codes->ne[1];
+    out_codes.resize(out_length);
+
+    ggml_backend_tensor_get(codes, out_codes.data(), 0, out_length * ggml_element_size(codes));
+
+    return true;
+}
+
 bool encodec_decompress_audio(struct encodec_context *ectx, const int32_t *codes,
                               const int n_codes, const int n_threads) {
     if (!encodec_eval(ectx, codes, n_codes, n_threads, encodec_run_mode_t::DECODE)) {
@@ -918,6 +1274,73 @@ bool encodec_decompress_audio(struct encodec_context *ectx, const int32_t *codes
 
     auto &out_audio = ectx->out_audio;
 
+    // drop the audio of the padding frames
+    const int n_frames = n_codes / ectx->codes->ne[1];
+    int out_length = decoded->ne[0] / ectx->codes->ne[0] * n_frames;
+    out_audio.resize(out_length);
+
+    ggml_backend_tensor_get(decoded, out_audio.data(), 0, out_length * ggml_element_size(decoded));
+
+    return true;
+}
+
+bool encodec_decompress_audio_stream(struct encodec_context *ectx, const int32_t *codes,
+                                     const int n_codes, const int n_threads) {
+    const auto & hparams = ectx->model.hparams;
+
+    const int frame_rate = (int)ceilf(hparams.sr / hparams.hop_length);
+    const int n_q = get_num_quantizers_for_bandwidth(hparams.n_bins, frame_rate, hparams.bandwidth);
+
+    auto & stream = ectx->stream;
+
+    if (n_codes % n_q != 0) {
+        fprintf(stderr, "%s: invalid number of codes\n", __func__);
+        return false;
+    }
+
+    if (n_codes == 0) {
+        ectx->out_audio.clear();
+        return true;
+    }
+
+    // the first chunk is padded by reflection, which needs more frames than the padding, so the
+    // frames are held back until there are enough
+    const int32_t * chunk_codes = codes;
+    int n_chunk_codes = n_codes;
+
+    std::vector<int32_t> first_codes;
+    if (!stream.started) {
+        const int n_pending = stream.pending_codes.size() / n_q;
+        const int n_new     = n_codes / n_q;
+
+        first_codes.resize(stream.pending_codes.size() + n_codes);
+        for (int q = 0; q < n_q; q++) {
+            int32_t * dst = first_codes.data() + q * (n_pending + n_new);
+            std::copy_n(stream.pending_codes.data() + q * n_pending, n_pending, dst);
+            std::copy_n(codes + q * n_new, n_new, dst + n_pending);
+        }
+
+        if (n_pending + n_new < hparams.kernel_size) {
+            stream.pending_codes = first_codes;
+            ectx->out_audio.clear();
+            return true;
+        }
+
+        stream.pending_codes.clear();
+
+        chunk_codes   = first_codes.data();
+        n_chunk_codes = first_codes.size();
+    }
+
+    if (!encodec_eval(ectx, chunk_codes, n_chunk_codes, n_threads, encodec_run_mode_t::DECODE_STREAM)) {
+        fprintf(stderr, "%s: failed to run encodec eval\n", __func__);
+        return false;
+    }
+
+    struct ggml_tensor *decoded = ectx->decoded;
+
+    auto &out_audio = ectx->out_audio;
+
     int out_length = decoded->ne[0];
     out_audio.resize(out_length);
 
@@ -926,6 +1349,86 @@ bool encodec_decompress_audio(struct encodec_context *ectx, const int32_t *codes
     return true;
 }
 
+bool encodec_flush_stream(struct encodec_context *ectx, int n_threads) {
+    auto & stream = ectx->stream;
+
+    ectx->out_audio.clear();
+    if (stream.started || stream.pending_codes.empty()) {
+        return true;
+    }
+
+    // the stream never had enough frames to start, its frames are decoded at once
+    std::vector<int32_t> codes;
+    codes.swap(stream.pending_codes);
+
+    return encodec_decompress_audio(ectx, codes.data(), codes.size(), n_threads);
+}
+
+void encodec_reset_stream(struct encodec_context *ectx) {
+    ectx->stream        = encodec_stream();
+    ectx->encode_stream = encodec_stream();
+}
+
+// Packs the weights of the convolutions as [in_channels, kernel_size, out_channels] for the
+// direct convolutions of the CPU backend in ops.cpp. The weights of a convolution are
+// [kernel_size, in_channels, out_channels], and [kernel_size, out_channels, in_channels] for a
+// transposed convolution, whose taps are reordered by ops.cpp for its stride. The weights are
+// permuted in place in the weight buffer, and the convolution gets a view of them with the packed
+// shape. The quantized weights are already packed.
+static bool encodec_pack_conv_weights(encodec_model &model) {
+    std::vector<encodec_conv_layer> convs = encodec_conv_layers(model);
+
+    struct ggml_init_params params = {
+        /* .mem_size   = */ ggml_tensor_overhead() * convs.size(),
+        /* .mem_buffer = */ NULL,
+        /* .no_alloc   = */ true,
+    };
+
+    model.ctx_packed = ggml_init(params);
+    if (!model.ctx_packed) {
+        fprintf(stderr, "%s: ggml_init() failed\n", __func__);
+        return false;
+    }
+
+    std::vector<uint8_t> data;
+    for (auto &layer : convs) {
+        struct encodec_conv *conv = layer.conv;
+        struct ggml_tensor *w = conv->w;
+
+        // quantized weights are packed in the model file
+        if (ggml_is_quantized(w->type)) {
+            conv->packed = true;
+            continue;
+        }
+
+        if (!encodec_conv_repacked(layer)) {
+            continue;
+        }
+
+        // the weights were copied into the weight buffer instead of being mapped
+        GGML_ASSERT(w->buffer == model.buffer_w && ggml_backend_buffer_is_host(w->buffer));
+
+        const int stride = layer.transposed_stride;
+        const int64_t kernel_size = w->ne[0];
+        const int64_t n_in  = stride ? w->ne[2] : w->ne[1];
+        const int64_t n_out = stride ? w->ne[1] : w->ne[2];
+
+        data.assign((const uint8_t *) w->data, (const uint8_t *) w->data + ggml_nbytes(w));
+
+        encodec_pack_conv_data((const char *) data.data(), (char *) w->data, ggml_element_size(w),
+                               kernel_size, n_in, n_out, stride);
+
+        struct ggml_tensor *p = ggml_view_3d(model.ctx_packed, w, n_in, kernel_size, n_out,
+                                             ggml_row_size(w->type, n_in), ggml_row_size(w->type, n_in * kernel_size), 0);
+        ggml_backend_view_init(p);
+
+        conv->w = p;
+        conv->packed = true;
+    }
+
+    return true;
+}
+
 // The offset parameter is used to adapt to two scenarios:
 // 1. If offset is 0, it is assumed the file only contains the Encodec weights, hence
 //    the model is loaded from the beginning of the file.
@@ -933,27 +1436,22 @@ bool encodec_decompress_audio(struct encodec_context *ectx, const int32_t *codes
 //    model, hence the model is loaded from the offset. This is the case for Bark.
 // Note that we used to have an encodec_load_model taking a reference to a file stream
 // but it was removed to comply the C-header requirements.
-struct encodec_context *encodec_load_model(const char* model_path, const int offset, int n_gpu_layers) {
+static struct encodec_context *encodec_load_model_from_file(encodec_model_file &infile, int n_gpu_layers) {
     int64_t t_start_load_us = ggml_time_us();
 
-    auto infile = std::ifstream(model_path, std::ios::binary);
-    if (!infile) {
-        fprintf(stderr, "%s: failed to open '%s'\n", __func__, model_path);
-        return nullptr;
-    }
-
-    if (offset > 0) {
-        infile.seekg(offset);
-    }
-
     struct encodec_context *ectx = new encodec_context();
 
     ectx->model = encodec_model();
     if (!encodec_load_model_weights(infile, ectx->model, n_gpu_layers)) {
-        fprintf(stderr, "%s: failed to load model weights from '%s'\n", __func__, model_path);
         return {};
     }
 
+    if (ggml_backend_is_cpu(ectx->model.backend) && !encodec_pack_conv_weights(ectx->model)) {
+        return {};
+    }
+
+    encodec_quantizer_init_norms(&ectx->model.quantizer);
+
     // pre-compute the number of codebooks required
     int bandwidth = ectx->model.hparams.bandwidth;
     int sr = ectx->model.hparams.sr;
@@ -972,6 +1470,219 @@ struct encodec_context *encodec_load_model(const char* model_path, const int off
     return ectx;
 }
 
+struct encodec_context *encodec_load_model(const char* model_path, const int offset, int n_gpu_layers) {
+    auto fin = std::ifstream(model_path, std::ios::binary);
+    if (!fin) {
+        fprintf(stderr, "%s: failed to open '%s'\n", __func__, model_path);
+        return nullptr;
+    }
+
+    if (offset > 0) {
+        fin.seekg(offset);
+    }
+
+    encodec_model_file infile;
+    infile.fin = &fin;
+
+    struct encodec_context *ectx = encodec_load_model_from_file(infile, n_gpu_layers);
+    if (!ectx) {
+        fprintf(stderr, "%s: failed to load model weights from '%s'\n", __func__, model_path);
+    }
+
+    return ectx;
+}
+
+struct encodec_context *encodec_load_model_from_memory(const void *data, size_t size, size_t offset, int n_gpu_layers) {
+    encodec_model_file infile;
+    infile.data = (const char *) data;
+    infile.size = size;
+    infile.pos  = offset;
+
+    struct encodec_context *ectx = encodec_load_model_from_file(infile, n_gpu_layers);
+    if (!ectx) {
+        fprintf(stderr, "%s: failed to load model weights from memory\n", __func__);
+    }
+
+    return ectx;
+}
+
+bool encodec_model_quantize(const char *fname_inp, const char *fname_out, const int offset, enum ggml_ftype ftype) {
+    const ggml_type qtype = ggml_ftype_to_ggml_type(ftype);
+    if (qtype == GGML_TYPE_COUNT || !ggml_is_quantized(qtype)) {
+        fprintf(stderr, "%s: invalid quantization type %d\n", __func__, ftype);
+        return false;
+    }
+
+    auto fin = std::ifstream(fname_inp, std::ios::binary);
+    if (!fin) {
+        fprintf(stderr, "%s: failed to open '%s' for reading\n", __func__, fname_inp);
+        return false;
+    }
+
+    auto fout = std::ofstream(fname_out, std::ios::binary);
+    if (!fout) {
+        fprintf(stderr, "%s: failed to open '%s' for writing\n", __func__, fname_out);
+        return false;
+    }
+
+    // the models stored before Encodec, such as the GPT models of Bark, are copied as they are
+    {
+        std::vector<char> head(offset);
+        fin.read(head.data(), head.size());
+        fout.write(head.data(), head.size());
+    }
+
+    uint32_t magic;
+    read_safe(fin, magic);
+    if (magic != 1734831468) {
+        fprintf(stderr, "%s: invalid model file '%s' (bad magic %d)\n", __func__, fname_inp, magic);
+        return false;
+    }
+    fout.write((char *) &magic, sizeof(magic));
+
+    encodec_hparams hparams;
+    {
+        int32_t values[9];
+        for (auto &v : values) {
+            read_safe(fin, v);
+        }
+
+        const int32_t ftype_src = values[8] % GGML_QNT_VERSION_FACTOR;
+        if (ftype_src != GGML_FTYPE_ALL_F32 && ftype_src != GGML_FTYPE_MOSTLY_F16) {
+            fprintf(stderr, "%s: model is already quantized (ftype %d)\n", __func__, ftype_src);
+            return false;
+        }
+
+        values[8] = GGML_QNT_VERSION * GGML_QNT_VERSION_FACTOR + ftype;
+        fout.write((char *) values, sizeof(values));
+    }
+
+    size_t total_size_org = 0;
+    size_t total_size_new = 0;
+
+    std::vector<char>  data;
+    std::vector<float> data_f32;
+    std::vector<float> packed;
+    std::vector<char>  work;
+
+    while (true) {
+        int32_t n_dims;
+        int32_t length;
+        int32_t ttype;
+
+        read_safe(fin, n_dims);
+        read_safe(fin, length);
+        read_safe(fin, ttype);
+
+        if (fin.eof()) {
+            break;
+        }
+
+        if (ttype != GGML_TYPE_F32 && ttype != GGML_TYPE_F16) {
+            fprintf(stderr, "%s: unsupported tensor type %d\n", __func__, ttype);
+            return false;
+        }
+
+        int32_t nelements = 1;
+        int32_t ne[3] = {1, 1, 1};
+        for (int i = 0; i < n_dims; i++) {
+            read_safe(fin, ne[i]);
+            nelements *= ne[i];
+        }
+
+        std::string name(length, 0);
+        fin.read(&name[0], length);
+        name.resize(strnlen(name.data(), length));
+
+        data.resize(nelements * ggml_type_size((ggml_type) ttype));
+        fin.read(data.data(), data.size());
+        if (!fin) {
+            fprintf(stderr, "%s: tensor '%s' is truncated in model file\n", __func__, name.c_str());
+            return false;
+        }
+
+        // the types the loader gives to the tensors of a quantized model, see encodec_load_model_weights
+        const bool is_weight  = name.find(".weight") != std::string::npos;
+        const bool is_decoder = name.rfind("decoder.", 0) == 0;
+        const bool is_convtr  = name.find(".convtr.") != std::string::npos;
+
+        int transposed_stride = 0;
+        if (is_convtr) {
+            // decoder.model.{3 * (i + 1)}.convtr.convtr.weight upsamples by ratios[i]
+            int layer = 0;
+            sscanf(name.c_str(), "decoder.model.%d.", &layer);
+            transposed_stride = hparams.ratios[std::min(std::max(layer / 3 - 1, 0), 3)];
+        }
+
+        const int64_t n_in = n_dims == 3 ? (is_convtr ? ne[2] : ne[1]) : ne[0];
+
+        bool quantize = is_weight && is_decoder && encodec_quantize_rows(qtype, n_in);
+        if (n_dims == 3) {
+            quantize &= !transposed_stride || ne[0] % transposed_stride == 0;
+        }
+
+        ggml_type type = (ggml_type) ttype;
+        if (quantize) {
+            type = qtype;
+        } else if (is_weight) {
+            type = GGML_TYPE_F16;
+        }
+
+        int32_t ne_out[3] = {ne[0], ne[1], ne[2]};
+        if (type != ttype) {
+            data_f32.resize(nelements);
+            if (ttype == GGML_TYPE_F16) {
+                ggml_fp16_to_fp32_row((const ggml_fp16_t *) data.data(), data_f32.data(), nelements);
+            } else {
+                memcpy(data_f32.data(), data.data(), nelements * sizeof(float));
+            }
+
+            const float *src = data_f32.data();
+            if (quantize && n_dims == 3) {
+                const int64_t n_out = is_convtr ? ne[1] : ne[2];
+                packed.resize(nelements);
+                encodec_pack_conv_data((const char *) data_f32.data(), (char *) packed.data(), sizeof(float),
+                                       ne[0], n_in, n_out, transposed_stride);
+                src = packed.data();
+
+                ne_out[0] = n_in;
+                ne_out[1] = ne[0];
+                ne_out[2] = n_out;
+            }
+
+            work.resize(ggml_row_size(type, nelements));
+            const size_t size = ggml_quantize_chunk(type, src, work.data(), 0, nelements / ne_out[0], ne_out[0], nullptr);
+            data.assign(work.data(), work.data() + size);
+        }
+
+        printf("%48s - [%5d, %5d, %5d], type = %6s -> %6s, size = %8.3f MB\n", name.c_str(), ne_out[0], ne_out[1], ne_out[2],
+               ggml_type_name((ggml_type) ttype), ggml_type_name(type), data.size() / 1024.0 / 1024.0);
+
+        length = name.size();
+        ttype  = type;
+
+        fout.write((char *) &n_dims, sizeof(n_dims));
+        fout.write((char *) &length, sizeof(length));
+        fout.write((char *) &ttype, sizeof(ttype));
+        fout.write((char *) ne_out, n_dims * sizeof(int32_t));
+        fout.write(name.data(), length);
+        fout.write(data.data(), data.size());
+
+        total_size_org += nelements * sizeof(float);
+        total_size_new += data.size();
+    }
+
+    if (!fout) {
+        fprintf(stderr, "%s: failed to write '%s'\n", __func__, fname_out);
+        return false;
+    }
+
+    printf("%s: model size  = %8.2f MB\n", __func__, total_size_org / 1024.0 / 1024.0);
+    printf("%s: quant size  = %8.2f MB | ftype = %d (%s)\n", __func__, total_size_new / 1024.0 / 1024.0, ftype, ggml_type_name(qtype));
+
+    return true;
+}
+
 void encodec_free(struct encodec_context *ectx) {
     if (!ectx) {
         return;
@@ -985,7 +1696,16 @@ void encodec_free(struct encodec_context *ectx) {
         ggml_backend_buffer_free(ectx->buf_compute);
     }
 
+    if (ectx->allocr) {
+        ggml_gallocr_free(ectx->allocr);
+    }
+
     ggml_backend_buffer_free(ectx->model.buffer_w);
+    ggml_backend_buffer_free(ectx->model.buffer_mapped);
+
+    if (ectx->model.ctx_packed) {
+        ggml_free(ectx->model.ctx_packed);
+    }
     ggml_backend_free(ectx->model.backend);
 
     delete ectx;
@@ -999,6 +1719,14 @@ void encodec_set_sample_rate(struct encodec_context *ectx, int sample_rate) {
     ectx->model.hparams.sr = sample_rate;
 }
 
+void encodec_set_threadpool(struct encodec_context *ectx, struct ggml_threadpool *threadpool, int lane) {
+    if (!ggml_backend_is_cpu(ectx->model.backend)) {
+        return;
+    }
+    ggml_backend_cpu_set_threadpool(ectx->model.backend, threadpool);
+    ggml_backend_cpu_set_lane(ectx->model.backend, lane);
+}
+
 const struct encodec_statistics* encodec_get_statistics(struct encodec_context *ectx) {
     if (!ectx) {
         fprintf(stderr, "%s: null context\n", __func__);
@@ -53,6 +53,22 @@ extern "C" {
         const int offset,
         int n_gpu_layers);
 
+    /**
+     * Loads an encodec model from memory, such as a memory mapped model file. The weights
+     * are used in place when they stay on the CPU, so the memory must outlive the context.
+     *
+     * @param data The memory holding the model.
+     * @param size The size (in bytes) of the memory.
+     * @param offset The offset (in bytes) to the start of the model in the memory.
+     * @param n_gpu_layers The number of GPU layers to use.
+     * @return A pointer to the encodec context struct.
+     */
+    struct encodec_context *encodec_load_model_from_memory(
+        const void *data,
+        size_t size,
+        size_t offset,
+        int n_gpu_layers);
+
     /**
      * Sets the target bandwidth for the given encodec context.
      *
@@ -73,6 +89,19 @@ extern "C" {
         struct encodec_context *ectx,
         int sample_rate);
 
+    /**
+     * Runs the graphs of the given encodec context on a CPU threadpool shared with other
+     * models. The graphs wait for the threadpool in a lane, lane 0 being the most urgent.
+     *
+     * @param ectx The encodec context to set the threadpool for.
+     * @param threadpool The shared threadpool, NULL to start threads for each graph.
+     * @param lane The lane waiting for the threadpool.
+     */
+    void encodec_set_threadpool(
+        struct encodec_context *ectx,
+        struct ggml_threadpool *threadpool,
+        int lane);
+
     /**
      * Reconstructs audio from raw audio data using the specified encodec context.
      *
@@ -103,6 +132,26 @@ extern "C" {
         const int n_samples,
         int n_threads);
 
+    /**
+     * Compresses a chunk of the audio of a stream. The encoder keeps the state of its
+     * convolutions and LSTM between the calls, so the codes of the chunks put end to end are
+     * the codes of all the audio compressed at once. The codes of the chunk are retrieved
+     * with encodec_get_codes.
+     *
+     * @param ectx The encodec context to use for compression.
+     * @param raw_audio The raw audio data of the chunk.
+     * @param n_samples The number of samples in the chunk, a multiple of the hop length.
+     * @param n_threads The number of threads to use for compression.
+     * @return True if the chunk was successfully compressed, false otherwise. A first chunk
+     *         with fewer frames than the convolution kernels is compressed on its own, and
+     *         the stream starts with the next chunk.
+     */
+    bool encodec_compress_audio_stream(
+        struct encodec_context *ectx,
+        const float *raw_audio,
+        const int n_samples,
+        int n_threads);
+
     /**
      * Decompresses audio data using the specified encodec context.
      *
@@ -118,6 +167,48 @@ extern "C" {
         const int n_codes,
         int n_threads);
 
+    /**
+     * Decompresses a chunk of the frames of a stream. The decoder keeps the state of its
+     * convolutions and LSTM between the calls, so the audio of the chunks put end to end is
+     * the audio of all the frames decompressed at once, and the memory used only depends on
+     * the size of the chunks. The audio of the chunk is retrieved with encodec_get_audio.
+     *
+     * @param ectx The encodec context to use for decompression.
+     * @param codes The codes of the chunk, laid out as in encodec_decompress_audio.
+     * @param n_codes The number of codes in the codes buffer.
+     * @param n_threads The number of threads to use for decompression.
+     * @return True if the chunk was successfully decompressed, false otherwise. The frames
+     *         are held back, with no audio, until the stream has as many frames as the
+     *         convolution kernels.
+     */
+    bool encodec_decompress_audio_stream(
+        struct encodec_context *ectx,
+        const int32_t *codes,
+        const int n_codes,
+        int n_threads);
+
+    /**
+     * Ends a stream. The frames held back by a stream shorter than the convolution kernels are
+     * decompressed on their own, and their audio is retrieved with encodec_get_audio, which is
+     * empty when no frames were held back.
+     *
+     * @param ectx The encodec context.
+     * @param n_threads The number of threads to use for decompression.
+     * @return True if the frames held back were successfully decompressed, false otherwise.
+     */
+    bool encodec_flush_stream(
+        struct encodec_context *ectx,
+        int n_threads);
+
+    /**
+     * Starts a new stream, the next chunk compressed or decompressed does not continue the
+     * previous ones.
+     *
+     * @param ectx The encodec context.
+     */
+    void encodec_reset_stream(
+        struct encodec_context *ectx);
+
     /**
      * Gets the audio data from the given encodec context.
      *
@@ -171,6 +262,25 @@ extern "C" {
    void encodec_reset_statistics(
         struct encodec_context *ectx);
 
+    /**
+     * Quantizes the decoder of an encodec model and saves the result to a file. The weights
+     * of the convolutions and of the LSTM are quantized and stored in the layout of the
+     * direct convolutions, the rows that do not fit the blocks of the type and the other
+     * weights are stored in F16. Quantized models only run on the CPU backend.
+     *
+     * @param fname_inp The name of the input file containing the encodec model.
+     * @param fname_out The name of the output file to save the quantized model to.
+     * @param offset The offset (in bytes) to the start of the model in the file, the bytes
+     *               before are copied as they are.
+     * @param ftype The type of the quantized weights, such as GGML_FTYPE_MOSTLY_Q8_0.
+     * @return True if the model was successfully quantized and saved, false otherwise.
+     */
+    bool encodec_model_quantize(
+        const char *fname_inp,
+        const char *fname_out,
+        const int offset,
+        enum ggml_ftype ftype);
+
     /**
      * @brief Frees the memory allocated for an encodec context.
      *
@@ -4,50 +4,47 @@
 
 #include "ggml.h"
 #include "lstm.h"
+#include "ops.h"
 
 // res + downsample block at some ratio
 struct encodec_encoder_block {
     // conv1
-    struct ggml_tensor *conv_1_w;
-    struct ggml_tensor *conv_1_b;
+    struct encodec_conv conv_1;
 
     // conv2
-    struct ggml_tensor *conv_2_w;
-    struct ggml_tensor *conv_2_b;
+    struct encodec_conv conv_2;
 
     // shortcut
-    struct ggml_tensor *conv_sc_w;
-    struct ggml_tensor *conv_sc_b;
+    struct encodec_conv conv_sc;
 
     // downsampling layers
-    struct ggml_tensor *ds_conv_w;
-    struct ggml_tensor *ds_conv_b;
+    struct encodec_conv ds_conv;
 };
 
 struct encodec_encoder {
-    struct ggml_tensor *init_conv_w;
-    struct ggml_tensor *init_conv_b;
+    struct encodec_conv init_conv;
 
     encodec_lstm lstm;
 
-    struct ggml_tensor *final_conv_w;
-    struct ggml_tensor *final_conv_b;
+    struct encodec_conv final_conv;
 
     std::vector<encodec_encoder_block> blocks;
 };
 
+// With a stream, inp is a chunk of whole frames of the audio, and the states of the convolutions
+// and of the LSTM continue from the previous chunk
 struct ggml_tensor *encodec_forward_encoder(
     const struct encodec_encoder *encoder, struct ggml_context *ctx0,
     struct ggml_tensor *inp, const int * ratios, const int kernel_size, const int res_kernel_size,
-    const int stride) {
+    const int stride, struct encodec_stream *stream) {
 
     if (!inp) {
         fprintf(stderr, "%s: null input tensor\n", __func__);
         return NULL;
     }
 
-    struct ggml_tensor *inpL = strided_conv_1d(
-        ctx0, inp, encoder->init_conv_w, encoder->init_conv_b, stride);
+    struct ggml_tensor *inpL = strided_conv_1d_stream(
+        ctx0, inp, &encoder->init_conv, stride, stream);
 
     for (int layer_ix = 0; layer_ix < 4; layer_ix++) {
         encodec_encoder_block block = encoder->blocks[layer_ix];
@@ -55,20 +52,20 @@ struct ggml_tensor *encodec_forward_encoder(
         struct ggml_tensor *current = inpL;
 
         // shortcut
-        struct ggml_tensor *shortcut = strided_conv_1d(
-            ctx0, inpL, block.conv_sc_w, block.conv_sc_b, stride);
+        struct ggml_tensor *shortcut = strided_conv_1d_stream(
+            ctx0, inpL, &block.conv_sc, stride, stream);
 
         // conv1
         current = ggml_elu(ctx0, current);
 
-        current = strided_conv_1d(
-            ctx0, current, block.conv_1_w, block.conv_1_b, stride);
+        current = strided_conv_1d_stream(
+            ctx0, current, &block.conv_1, stride, stream);
 
         // conv2
         current = ggml_elu(ctx0, current);
 
-        current = strided_conv_1d(
-            ctx0, current, block.conv_2_w, block.conv_2_b, stride);
+        current = strided_conv_1d_stream(
+            ctx0, current, &block.conv_2, stride, stream);
 
         // residual connection
         inpL = ggml_add(ctx0, current, shortcut);
@@ -76,8 +73,8 @@ struct ggml_tensor *encodec_forward_encoder(
         // downsampling layers
         inpL = ggml_elu(ctx0, inpL);
 
-        inpL = strided_conv_1d(
-            ctx0, inpL, block.ds_conv_w, block.ds_conv_b, ratios[3 - layer_ix]);
+        inpL = strided_conv_1d_stream(
+            ctx0, inpL, &block.ds_conv, ratios[3 - layer_ix], stream);
     }
 
     // lstm
@@ -89,12 +86,12 @@ struct ggml_tensor *encodec_forward_encoder(
         // first lstm layer
         char l0_prefix[7] = "enc_l0";
         struct ggml_tensor *hs1 = forward_pass_lstm_unilayer(
-            ctx0, cur, lstm.l0_ih_w, lstm.l0_hh_w, lstm.l0_ih_b, lstm.l0_hh_b, l0_prefix);
+            ctx0, cur, lstm.l0_ih_w, lstm.l0_hh_w, lstm.l0_ih_b, lstm.l0_hh_b, l0_prefix, stream);
 
         // second lstm layer
         char l1_prefix[7] = "enc_l1";
         struct ggml_tensor *out = forward_pass_lstm_unilayer(
-            ctx0, hs1, lstm.l1_ih_w, lstm.l1_hh_w, lstm.l1_ih_b, lstm.l1_hh_b, l1_prefix);
+            ctx0, hs1, lstm.l1_ih_w, lstm.l1_hh_w, lstm.l1_ih_b, lstm.l1_hh_b, l1_prefix, stream);
 
         inpL = ggml_add(ctx0, inpL, out);
     }
@@ -102,8 +99,8 @@ struct ggml_tensor *encodec_forward_encoder(
     // final conv
     inpL = ggml_elu(ctx0, inpL);
 
-    struct ggml_tensor *encoded_inp = strided_conv_1d(
-        ctx0, inpL, encoder->final_conv_w, encoder->final_conv_b, stride);
+    struct ggml_tensor *encoded_inp = strided_conv_1d_stream(
+        ctx0, inpL, &encoder->final_conv, stride, stream);
 
     return encoded_inp;
 }
@@ -1,7 +1,15 @@
 #pragma once
 
+#include <atomic>
+#include <cmath>
+#include <cstring>
+#include <thread>
+#include <vector>
+
 #include "ggml.h"
 #include "ggml-alloc.h"
+#include "ggml-backend.h"
+#include "ggml-cpu.h"
 
 #include "ops.h"
 
@@ -19,33 +27,160 @@ struct encodec_lstm {
     struct ggml_tensor *l1_hh_b;
 };
 
-struct ggml_tensor *forward_pass_lstm_unilayer(struct ggml_context *ctx0,
-                                               struct ggml_tensor  *inp,
-                                               struct ggml_tensor  *weight_ih,
-                                               struct ggml_tensor  *weight_hh,
-                                               struct ggml_tensor  *bias_ih,
-                                               struct ggml_tensor  *bias_hh,
-                                               char                *prefix) {
+// The fused LSTM is a custom operator of the CPU backend, it runs when the weights are in host
+// memory: loaded into a CPU buffer or used in place from a mapping. Other backends run the
+// unrolled graph
+static bool encodec_lstm_use_fused(const struct ggml_tensor *weight_hh) {
+    return weight_hh->buffer && ggml_backend_buffer_is_host(weight_hh->buffer);
+}
+
+// Both layers of the LSTM are fused
+static bool encodec_lstm_use_fused(const struct encodec_lstm &lstm) {
+    return encodec_lstm_use_fused(lstm.l0_hh_w) && encodec_lstm_use_fused(lstm.l1_hh_w);
+}
+
+static_assert(sizeof(std::atomic<int32_t>) == sizeof(float), "the step counter is stored in an F32 tensor");
+
+// Recurrence of the LSTM over all the timesteps. gates holds the input projection and both biases
+// of each timestep [4*hidden_dim, seq_length], and state the initial hidden and cell states
+// followed by a step counter. Each thread updates its own hidden units, and the threads wait for
+// each other after every timestep on the counter, which is zero before the graph runs. The hidden
+// and cell states of timestep t are written to rows [0, hidden_dim) and [hidden_dim, 2*hidden_dim)
+// of column t of dst.
+static void encodec_lstm_recurrence(struct ggml_tensor *dst, const struct ggml_tensor *gates,
+                                    const struct ggml_tensor *weight_hh, const struct ggml_tensor *state,
+                                    int ith, int nth, void *userdata) {
+    const int seq_length = gates->ne[1];
+    const int hidden_dim = weight_hh->ne[0];
+
+    const auto *traits     = ggml_get_type_traits_cpu(weight_hh->type);
+    const auto *dot_traits = ggml_get_type_traits_cpu(traits->vec_dot_type);
+
+    const int j0 = hidden_dim * ith / nth;
+    const int j1 = hidden_dim * (ith + 1) / nth;
+
+    std::atomic<int32_t> *n_done = (std::atomic<int32_t> *) ((float *) state->data + 2 * hidden_dim);
+
+    // previous hidden state in the type of the dot products
+    std::vector<uint8_t> h_prev(ggml_row_size(traits->vec_dot_type, hidden_dim));
+
+    for (int t = 0; t < seq_length; t++) {
+        const float *g = (const float *) ((const char *) gates->data + t * gates->nb[1]);
+        float *h = (float *) ((char *) dst->data + t * dst->nb[1]);
+        float *c = h + hidden_dim;
+
+        const float *h_last = t > 0 ? (const float *) ((const char *) dst->data + (t - 1) * dst->nb[1]) : (const float *) state->data;
+        const float *c_last = h_last + hidden_dim;
+
+        if (traits->vec_dot_type == GGML_TYPE_F32) {
+            memcpy(h_prev.data(), h_last, hidden_dim * sizeof(float));
+        } else {
+            dot_traits->from_float(h_last, h_prev.data(), hidden_dim);
+        }
+
+        for (int j = j0; j < j1; j++) {
+            float z[4];
+            for (int k = 0; k < 4; k++) {
+                float s;
+                const char *w = (const char *) weight_hh->data + (k * hidden_dim + j) * weight_hh->nb[1];
+                traits->vec_dot(hidden_dim, &s, 0, w, 0, h_prev.data(), 0, 1);
+                z[k] = g[k * hidden_dim + j] + s;
+            }
+
+            const float i_t = 1.0f / (1.0f + expf(-z[0]));
+            const float f_t = 1.0f / (1.0f + expf(-z[1]));
+            const float g_t = tanhf(z[2]);
+            const float o_t = 1.0f / (1.0f + expf(-z[3]));
+
+            c[j] = f_t * c_last[j] + i_t * g_t;
+            h[j] = o_t * tanhf(c[j]);
+        }
+
+        // wait for the hidden state of this timestep to be complete
+        if (nth > 1 && t + 1 < seq_length) {
+            n_done->fetch_add(1, std::memory_order_acq_rel);
+            while (n_done->load(std::memory_order_acquire) < nth * (t + 1)) {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+    GGML_UNUSED(userdata);
+}
+
+// LSTM layer as the input projection of all the timesteps in one matrix multiplication, followed
+// by the recurrence in a single node, so the graph does not grow with the length of the audio.
+// Returns the hidden states, and the last hidden and cell states in last_state.
+struct ggml_tensor *forward_pass_lstm_fused(struct ggml_context *ctx0,
+                                            struct ggml_tensor  *inp,
+                                            struct ggml_tensor  *weight_ih,
+                                            struct ggml_tensor  *weight_hh,
+                                            struct ggml_tensor  *bias_ih,
+                                            struct ggml_tensor  *bias_hh,
+                                            struct ggml_tensor  *state,
+                                            struct ggml_tensor **last_state) {
+    const int seq_length = inp->ne[0];
+    const int hidden_dim = weight_ih->ne[1] / 4;
+
+    struct ggml_tensor *current = ggml_cont(ctx0, ggml_transpose(ctx0, inp));
+
+    struct ggml_tensor *gates = ggml_mul_mat(ctx0, weight_ih, current);
+    gates = ggml_add(ctx0, gates, bias_ih);
+    gates = ggml_add(ctx0, gates, bias_hh);
+
+    struct ggml_tensor *states = ggml_map_custom3(ctx0, gates, weight_hh, state, encodec_lstm_recurrence, GGML_N_TASKS_MAX, NULL);
+
+    *last_state = ggml_view_1d(ctx0, states, 2 * hidden_dim, (seq_length - 1) * states->nb[1]);
+
+    struct ggml_tensor *hs = ggml_view_2d(ctx0, states, hidden_dim, seq_length, states->nb[1], 0);
+    hs = ggml_cont(ctx0, ggml_transpose(ctx0, hs));
+
+    return hs;
+}
+
+// The state input of the layer, named <prefix>_state, holds the initial hidden and cell states
+// and the step counter of the fused LSTM, and must be zeroed before the graph runs. In a stream,
+// the last states are saved for the next chunk and replace the zeros of the next chunk.
+struct ggml_tensor *forward_pass_lstm_unilayer(struct ggml_context   *ctx0,
+                                               struct ggml_tensor    *inp,
+                                               struct ggml_tensor    *weight_ih,
+                                               struct ggml_tensor    *weight_hh,
+                                               struct ggml_tensor    *bias_ih,
+                                               struct ggml_tensor    *bias_hh,
+                                               char                  *prefix,
+                                               struct encodec_stream *stream) {
     const int seq_length = inp->ne[0];
     const int input_dim  = inp->ne[1];
     const int hidden_dim = weight_ih->ne[1] / 4;
 
-    char ct_name[10];
-    char ht_name[10];
+    char state_name[16];
+    snprintf(state_name, sizeof(state_name), "%s_state", prefix);
 
-    snprintf(ct_name, 10, "%s_ct", prefix);
-    snprintf(ht_name, 10, "%s_ht", prefix);
+    struct ggml_tensor *state = ggml_new_tensor_1d(ctx0, GGML_TYPE_F32, 2 * hidden_dim + 1);
+    ggml_set_input(state);
+    ggml_set_name(state, state_name);
+
+    if (stream) {
+        stream->inputs.push_back(stream->started ? state : NULL);
+    }
+
+    if (encodec_lstm_use_fused(weight_hh)) {
+        struct ggml_tensor *last_state = NULL;
+        struct ggml_tensor *hs = forward_pass_lstm_fused(
+            ctx0, inp, weight_ih, weight_hh, bias_ih, bias_hh, state, &last_state);
+
+        if (stream) {
+            encodec_stream_output(ctx0, stream, last_state);
+        }
+
+        return hs;
+    }
 
     struct ggml_tensor *hs = ggml_new_tensor_2d(ctx0, GGML_TYPE_F32, hidden_dim, seq_length);
     ggml_set_input(hs);
 
-    struct ggml_tensor *c_t = ggml_new_tensor_1d(ctx0, GGML_TYPE_F32, hidden_dim);
-    ggml_set_input(c_t);
-    ggml_set_name(c_t, ct_name);
-
-    struct ggml_tensor *h_t = ggml_new_tensor_1d(ctx0, GGML_TYPE_F32, hidden_dim);
-    ggml_set_input(h_t);
-    ggml_set_name(h_t, ht_name);
+    struct ggml_tensor *h_t = ggml_view_1d(ctx0, state, hidden_dim, 0);
+    struct ggml_tensor *c_t = ggml_view_1d(ctx0, state, hidden_dim, hidden_dim * state->nb[0]);
 
     struct ggml_tensor *current = ggml_cont(ctx0, ggml_transpose(ctx0, inp));
 
@@ -72,6 +207,10 @@ struct ggml_tensor *forward_pass_lstm_unilayer(struct ggml_context *ctx0,
         hs = ggml_set_1d(ctx0, hs, h_t, t * hs->nb[1]);
     }
 
+    if (stream) {
+        encodec_stream_output(ctx0, stream, ggml_concat(ctx0, h_t, c_t, 0));
+    }
+
     hs = ggml_cont(ctx0, ggml_transpose(ctx0, hs));
 
     return hs;
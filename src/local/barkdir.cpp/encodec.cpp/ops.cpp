@@ -1,9 +1,13 @@
 #include <algorithm>
 #include <cassert>
 #include <cmath>
+#include <cstdint>
+#include <cstring>
 #include <stdexcept>
+#include <vector>
 
 #include "ggml.h"
+#include "ggml-cpu.h"
 
 #include "ops.h"
 
@@ -56,36 +60,281 @@ struct ggml_tensor *unpad_1d(struct ggml_context *ctx0, struct ggml_tensor *inp,
     return dst;
 }
 
+// Direct convolutions of the CPU backend. The weights are packed when the model is loaded as
+// [in_channels, kernel_size, out_channels], and the input is transposed tile by tile into rows of
+// the type of the dot products, so that an output sample is a dot product over consecutive rows
+// and the overlapping windows of the outputs share the rows. The padding, the bias and the state
+// of a stream are read in place instead of being copied around the convolution.
+
+// output steps or samples computed together by a thread
+#define ENCODEC_CONV_TILE 32
+
+static int conv_kernel_size(const struct encodec_conv *conv) {
+    return conv->packed ? conv->w->ne[1] : conv->w->ne[0];
+}
+
+// Transposes the input steps [i0, i1) into rows of the type of the dot products. src returns the
+// first channel of a step and sets the bytes between its channels, or returns NULL for zeros.
+template <typename F>
+static void transpose_steps(int i0, int i1, int n_channels, const struct ggml_tensor *weight,
+                            std::vector<float> &rows, std::vector<uint8_t> &rows_q, F src) {
+    const auto *traits     = ggml_get_type_traits_cpu(weight->type);
+    const auto *dot_traits = ggml_get_type_traits_cpu(traits->vec_dot_type);
+
+    rows.resize((size_t) (i1 - i0) * n_channels);
+    for (int i = i0; i < i1; i++) {
+        float *row = rows.data() + (size_t) (i - i0) * n_channels;
+        size_t nb1 = 0;
+        const char *x = (const char *) src(i, nb1);
+        if (!x) {
+            std::fill(row, row + n_channels, 0.0f);
+            continue;
+        }
+        for (int c = 0; c < n_channels; c++) {
+            row[c] = *(const float *) (x + c * nb1);
+        }
+    }
+
+    if (traits->vec_dot_type != GGML_TYPE_F32) {
+        const size_t row_size = ggml_row_size(traits->vec_dot_type, n_channels);
+        rows_q.resize((i1 - i0) * row_size);
+        for (int i = 0; i < i1 - i0; i++) {
+            dot_traits->from_float(rows.data() + (size_t) i * n_channels, rows_q.data() + i * row_size, n_channels);
+        }
+    }
+}
+
+// Causal convolution of the input [length_in, in_channels] in dst->src[0] with the weight
+// [in_channels, kernel_size, out_channels] in dst->src[1] and the bias in dst->src[2], stride in
+// userdata. The kernel_size - stride steps of padding on the left are reflected, or read from the
+// context of a stream in dst->src[3], and the steps on the right that complete the last output
+// are reflected.
+static void conv_1d_kernel(struct ggml_tensor *dst, int ith, int nth, void *userdata) {
+    const struct ggml_tensor *inp     = dst->src[0];
+    const struct ggml_tensor *weight  = dst->src[1];
+    const struct ggml_tensor *bias    = dst->src[2];
+    const struct ggml_tensor *context = dst->src[3];
+
+    const int stride      = (int) (intptr_t) userdata;
+    const int length_in   = inp->ne[0];
+    const int n_channels  = inp->ne[1];
+    const int kernel_size = weight->ne[1];
+    const int length      = dst->ne[0];
+    const int n_out       = dst->ne[1];
+
+    const int pad_left  = context ? context->ne[0] : kernel_size - stride;
+    const int pad_right = (length - 1) * stride + kernel_size - length_in - pad_left;
+
+    // short inputs are padded with zeros before the reflection
+    const int length_reflect = std::max(length_in, std::max(pad_left, pad_right) + 1);
+
+    const auto *traits = ggml_get_type_traits_cpu(weight->type);
+    const size_t row_size = ggml_row_size(traits->vec_dot_type, n_channels);
+
+    std::vector<float> rows;
+    std::vector<uint8_t> rows_q;
+
+    const int t0 = length * ith / nth;
+    const int t1 = length * (ith + 1) / nth;
+
+    for (int ts = t0; ts < t1; ts += ENCODEC_CONV_TILE) {
+        const int te = std::min(ts + ENCODEC_CONV_TILE, t1);
+        const int p0 = ts * stride;
+        const int p1 = (te - 1) * stride + kernel_size;
+
+        transpose_steps(p0, p1, n_channels, weight, rows, rows_q, [&](int p, size_t &nb1) -> const void * {
+            if (context && p < pad_left) {
+                nb1 = context->nb[1];
+                return (const char *) context->data + p * context->nb[0];
+            }
+            int q = p - pad_left;
+            if (!context) {
+                q = q < 0 ? -q : q;
+                q = q >= length_reflect ? 2 * (length_reflect - 1) - q : q;
+            }
+            nb1 = inp->nb[1];
+            return q < length_in ? (const char *) inp->data + q * inp->nb[0] : NULL;
+        });
+
+        const char *x = traits->vec_dot_type == GGML_TYPE_F32 ? (const char *) rows.data() : (const char *) rows_q.data();
+
+        for (int o = 0; o < n_out; o++) {
+            const float b = ((const float *) bias->data)[o];
+            float *y = (float *) ((char *) dst->data + o * dst->nb[1]);
+
+            // the kernel_size steps of an output are consecutive rows, a single dot product with
+            // the weights of the output channel
+            const char *w = (const char *) weight->data + o * weight->nb[2];
+            for (int t = ts; t < te; t++) {
+                float sum;
+                traits->vec_dot(kernel_size * n_channels, &sum, 0, w, 0, x + (t * stride - p0) * row_size, 0, 1);
+                y[t] = sum + b;
+            }
+        }
+    }
+}
+
+// Transposed convolution of the input [length_in, in_channels] in dst->src[0] with the weight
+// [in_channels, kernel_size, out_channels] in dst->src[1], stride in userdata, trimmed on the right
+// to length_in * stride samples to which the bias in dst->src[2] is added. The output of a stream
+// is followed by the kernel_size - stride samples that overlap the next chunk, [out_channels,
+// length_in * stride] then [out_channels, overlap], and the overlap of the previous chunk in
+// dst->src[3] is added to the first samples.
+//
+// Sample j = q * stride + r gets tap k = r + m * stride of the steps q - m. The taps of each r are
+// packed by decreasing m, so that the steps of a sample are consecutive rows and their product
+// with the weights is a single dot product, except for the first and the last samples.
+static void conv_transpose_1d_kernel(struct ggml_tensor *dst, int ith, int nth, void *userdata) {
+    const struct ggml_tensor *inp     = dst->src[0];
+    const struct ggml_tensor *weight  = dst->src[1];
+    const struct ggml_tensor *bias    = dst->src[2];
+    const struct ggml_tensor *overlap = dst->src[3];
+
+    const int stride      = (int) (intptr_t) userdata;
+    const int length_in   = inp->ne[0];
+    const int n_channels  = inp->ne[1];
+    const int kernel_size = weight->ne[1];
+    const int n_taps      = kernel_size / stride;
+    const int n_out       = weight->ne[2];
+    const int length      = length_in * stride;
+    const int n_samples   = ggml_nelements(dst) / n_out;
+    const int n_tail      = n_samples - length;
+
+    const int n_overlap = overlap ? overlap->ne[0] : 0;
+
+    const auto *traits = ggml_get_type_traits_cpu(weight->type);
+    const size_t row_size = ggml_row_size(traits->vec_dot_type, n_channels);
+
+    std::vector<float> rows;
+    std::vector<uint8_t> rows_q;
+
+    const int j0 = n_samples * ith / nth;
+    const int j1 = n_samples * (ith + 1) / nth;
+
+    for (int js = j0; js < j1; js += ENCODEC_CONV_TILE) {
+        const int je = std::min(js + ENCODEC_CONV_TILE, j1);
+
+        // the input steps contributing to the samples of the tile
+        const int i0 = std::max(0, js / stride - n_taps + 1);
+        const int i1 = std::min(length_in, (je - 1) / stride + 1);
+
+        transpose_steps(i0, i1, n_channels, weight, rows, rows_q, [&](int i, size_t &nb1) -> const void * {
+            nb1 = inp->nb[1];
+            return (const char *) inp->data + i * inp->nb[0];
+        });
+
+        const char *x = traits->vec_dot_type == GGML_TYPE_F32 ? (const char *) rows.data() : (const char *) rows_q.data();
+
+        for (int o = 0; o < n_out; o++) {
+            const float b = ((const float *) bias->data)[o];
+            const float *ov = overlap ? (const float *) ((const char *) overlap->data + o * overlap->nb[1]) : NULL;
+
+            for (int j = js; j < je; j++) {
+                const int q = j / stride;
+                const int r = j % stride;
+                const char *w = (const char *) weight->data + o * weight->nb[2] + r * n_taps * weight->nb[1];
+
+                float sum = 0.0f;
+                if (q - n_taps + 1 >= 0 && q < length_in) {
+                    traits->vec_dot(n_taps * n_channels, &sum, 0, w, 0, x + (q - n_taps + 1 - i0) * row_size, 0, 1);
+                } else {
+                    for (int m = 0; m < n_taps; m++) {
+                        const int i = q - m;
+                        if (i < 0 || i >= length_in) {
+                            continue;
+                        }
+                        float s;
+                        traits->vec_dot(n_channels, &s, 0, w + (n_taps - 1 - m) * weight->nb[1], 0, x + (i - i0) * row_size, 0, 1);
+                        sum += s;
+                    }
+                }
+                if (j < n_overlap) {
+                    sum += ov[j];
+                }
+                if (j < length) {
+                    ((float *) dst->data)[o * length + j] = sum + b;
+                } else {
+                    ((float *) dst->data)[n_out * length + o * n_tail + j - length] = sum;
+                }
+            }
+        }
+    }
+}
+
+static struct ggml_tensor *conv_1d_fused(struct ggml_context *ctx0, struct ggml_tensor *inp,
+                                         const struct encodec_conv *conv, struct ggml_tensor *context,
+                                         int stride) {
+    struct ggml_tensor *weight = conv->w;
+
+    const int kernel_size = weight->ne[1];
+    const int padding_total = kernel_size - stride;
+    const int extra_padding = context ? 0 : get_extra_padding_for_conv_1d(inp, kernel_size, stride, padding_total);
+    const int length = (inp->ne[0] + padding_total + extra_padding - kernel_size) / stride + 1;
+
+    struct ggml_tensor *args[] = {inp, weight, conv->b, context};
+
+    return ggml_custom_4d(ctx0, GGML_TYPE_F32, length, weight->ne[2], 1, 1, args, context ? 4 : 3,
+                          conv_1d_kernel, GGML_N_TASKS_MAX, (void *) (intptr_t) stride);
+}
+
+// Returns [out_channels * length_in * stride] followed by the overlap with the next chunk when
+// with_tail is set
+static struct ggml_tensor *conv_transpose_1d_fused(struct ggml_context *ctx0, struct ggml_tensor *inp,
+                                                   const struct encodec_conv *conv, struct ggml_tensor *overlap,
+                                                   int stride, bool with_tail) {
+    struct ggml_tensor *weight = conv->w;
+
+    const int length = inp->ne[0] * stride;
+    const int n_tail = with_tail ? weight->ne[1] - stride : 0;
+    const int n_out  = weight->ne[2];
+
+    struct ggml_tensor *args[] = {inp, weight, conv->b, overlap};
+    const int n_args = overlap ? 4 : 3;
+
+    if (with_tail) {
+        return ggml_custom_4d(ctx0, GGML_TYPE_F32, (length + n_tail) * n_out, 1, 1, 1, args, n_args,
+                              conv_transpose_1d_kernel, GGML_N_TASKS_MAX, (void *) (intptr_t) stride);
+    }
+    return ggml_custom_4d(ctx0, GGML_TYPE_F32, length, n_out, 1, 1, args, n_args,
+                          conv_transpose_1d_kernel, GGML_N_TASKS_MAX, (void *) (intptr_t) stride);
+}
+
 struct ggml_tensor *strided_conv_1d(struct ggml_context *ctx0, struct ggml_tensor *inp,
-                                    struct ggml_tensor *conv_w, struct ggml_tensor *conv_b,
-                                    int stride) {
-    int kernel_size = conv_w->ne[0];
+                                    const struct encodec_conv *conv, int stride) {
+    if (conv->packed) {
+        return conv_1d_fused(ctx0, inp, conv, NULL, stride);
+    }
+
+    int kernel_size = conv->w->ne[0];
     int padding_total = kernel_size - stride;
     int extra_padding = get_extra_padding_for_conv_1d(inp, kernel_size, stride, padding_total);
 
     struct ggml_tensor *padded_inp = pad_1d(ctx0, inp, padding_total, extra_padding);
-    struct ggml_tensor *dst = ggml_conv_1d(ctx0, conv_w, padded_inp, stride, 0, 1);
+    struct ggml_tensor *dst = ggml_conv_1d(ctx0, conv->w, padded_inp, stride, 0, 1);
 
     // add bias
     dst = ggml_transpose(ctx0, dst);
-    dst = ggml_add(ctx0, ggml_repeat(ctx0, conv_b, dst), dst);
+    dst = ggml_add(ctx0, ggml_repeat(ctx0, conv->b, dst), dst);
     dst = ggml_cont(ctx0, ggml_transpose(ctx0, dst));
 
     return dst;
 }
 
 struct ggml_tensor *strided_conv_transpose_1d(struct ggml_context *ctx0, struct ggml_tensor *inp,
-                                              struct ggml_tensor *conv_w, struct ggml_tensor *conv_b,
-                                              int stride) {
+                                              const struct encodec_conv *conv, int stride) {
+    if (conv->packed) {
+        return conv_transpose_1d_fused(ctx0, inp, conv, NULL, stride, false);
+    }
+
     struct ggml_tensor *dst = ggml_conv_transpose_1d(
-        ctx0, conv_w, inp, stride, 0 /* p0 */, 1 /* d0 */);
+        ctx0, conv->w, inp, stride, 0 /* p0 */, 1 /* d0 */);
 
     // add bias
     dst = ggml_transpose(ctx0, dst);
-    dst = ggml_add(ctx0, ggml_repeat(ctx0, conv_b, dst), dst);
+    dst = ggml_add(ctx0, ggml_repeat(ctx0, conv->b, dst), dst);
     dst = ggml_cont(ctx0, ggml_transpose(ctx0, dst));
 
-    int kernel_size = conv_w->ne[0];
+    int kernel_size = conv->w->ne[0];
     int padding_total = kernel_size - stride;
 
     int padding_right = ceilf(padding_total);
@@ -96,3 +345,114 @@ struct ggml_tensor *strided_conv_transpose_1d(struct ggml_context *ctx0, struct
 
     return unpadded;
 }
+
+struct ggml_tensor *encodec_stream_input(struct ggml_context *ctx0, struct encodec_stream *stream,
+                                         int64_t ne0, int64_t ne1) {
+    struct ggml_tensor *state = NULL;
+    if (stream->started) {
+        state = ggml_new_tensor_2d(ctx0, GGML_TYPE_F32, ne0, ne1);
+        ggml_set_input(state);
+    }
+
+    stream->inputs.push_back(state);
+
+    return state;
+}
+
+void encodec_stream_output(struct ggml_context *ctx0, struct encodec_stream *stream,
+                           struct ggml_tensor *state) {
+    state = ggml_cont(ctx0, state);
+    ggml_set_output(state);
+
+    stream->outputs.push_back(state);
+}
+
+static struct ggml_tensor *add_bias_1d(struct ggml_context *ctx0, struct ggml_tensor *inp,
+                                       struct ggml_tensor *conv_b) {
+    struct ggml_tensor *dst = ggml_transpose(ctx0, inp);
+    dst = ggml_add(ctx0, ggml_repeat(ctx0, conv_b, dst), dst);
+    dst = ggml_cont(ctx0, ggml_transpose(ctx0, dst));
+
+    return dst;
+}
+
+struct ggml_tensor *strided_conv_1d_stream(struct ggml_context *ctx0, struct ggml_tensor *inp,
+                                           const struct encodec_conv *conv, int stride,
+                                           struct encodec_stream *stream) {
+    int kernel_size = conv_kernel_size(conv);
+    int padding_total = kernel_size - stride;
+
+    if (!stream || padding_total == 0) {
+        return strided_conv_1d(ctx0, inp, conv, stride);
+    }
+
+    // the padding on the right of strided convolutions depends on the length of the whole input,
+    // there is none when the chunk is a whole number of steps
+    GGML_ASSERT(inp->ne[0] % stride == 0);
+
+    // the last input frames of the previous chunk replace the padding of the first chunk
+    struct ggml_tensor *context = encodec_stream_input(ctx0, stream, padding_total, inp->ne[1]);
+
+    if (conv->packed) {
+        // the padding is only needed for the state when the chunk is shorter than the padding
+        struct ggml_tensor *padded = inp;
+        if (inp->ne[0] < padding_total) {
+            padded = context ? ggml_concat(ctx0, context, inp, 0) : pad_1d(ctx0, inp, padding_total, 0);
+        }
+
+        encodec_stream_output(ctx0, stream, ggml_view_2d(ctx0, padded, padding_total, padded->ne[1], padded->nb[1],
+                                                         (padded->ne[0] - padding_total) * padded->nb[0]));
+
+        return conv_1d_fused(ctx0, inp, conv, context, stride);
+    }
+
+    struct ggml_tensor *padded = context ? ggml_concat(ctx0, context, inp, 0) : pad_1d(ctx0, inp, padding_total, 0);
+
+    encodec_stream_output(ctx0, stream, ggml_view_2d(ctx0, padded, padding_total, padded->ne[1], padded->nb[1],
+                                                     (padded->ne[0] - padding_total) * padded->nb[0]));
+
+    struct ggml_tensor *dst = ggml_conv_1d(ctx0, conv->w, padded, stride, 0, 1);
+
+    return add_bias_1d(ctx0, dst, conv->b);
+}
+
+struct ggml_tensor *strided_conv_transpose_1d_stream(struct ggml_context *ctx0, struct ggml_tensor *inp,
+                                                     const struct encodec_conv *conv, int stride,
+                                                     struct encodec_stream *stream) {
+    int kernel_size = conv_kernel_size(conv);
+    int padding_total = kernel_size - stride;
+    int length = inp->ne[0] * stride;
+
+    if (!stream || padding_total == 0) {
+        return strided_conv_transpose_1d(ctx0, inp, conv, stride);
+    }
+
+    if (conv->packed) {
+        struct ggml_tensor *overlap = encodec_stream_input(ctx0, stream, padding_total, conv->b->ne[0]);
+
+        struct ggml_tensor *dst = conv_transpose_1d_fused(ctx0, inp, conv, overlap, stride, true);
+
+        const int n_out = conv->b->ne[0];
+        encodec_stream_output(ctx0, stream, ggml_view_2d(ctx0, dst, padding_total, n_out, padding_total * dst->nb[0],
+                                                         n_out * length * dst->nb[0]));
+
+        return ggml_view_2d(ctx0, dst, length, n_out, length * dst->nb[0], 0);
+    }
+
+    struct ggml_tensor *dst = ggml_conv_transpose_1d(
+        ctx0, conv->w, inp, stride, 0 /* p0 */, 1 /* d0 */);
+
+    // the last input frames of the previous chunk overlap the start of this one, the bias is
+    // only added once
+    struct ggml_tensor *overlap = encodec_stream_input(ctx0, stream, padding_total, dst->ne[1]);
+    if (overlap) {
+        dst = ggml_add(ctx0, dst, ggml_pad(ctx0, overlap, dst->ne[0] - padding_total, 0, 0, 0));
+    }
+
+    encodec_stream_output(ctx0, stream, ggml_view_2d(ctx0, dst, padding_total, dst->ne[1], dst->nb[1],
+                                                     length * dst->nb[0]));
+
+    dst = ggml_cont(ctx0, ggml_view_2d(ctx0, dst, length, dst->ne[1], dst->nb[1], 0));
+
+    return add_bias_1d(ctx0, dst, conv->b);
+}
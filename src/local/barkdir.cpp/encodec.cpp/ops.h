@@ -1,7 +1,47 @@
 #pragma once
 
+#include <vector>
+
 #include "ggml.h"
 
+// State carried between the chunks of a streamed encode or decode. The layers of the encoder or
+// of the decoder add their states in the order they are built, so the states saved by a chunk are
+// the inputs of the same layers in the next chunk.
+struct encodec_stream {
+    // a chunk was run since the stream was reset
+    bool started = false;
+
+    // inputs of the states of the chunk being built, NULL on the first chunk
+    std::vector<struct ggml_tensor *> inputs;
+    // states computed by the chunk being built for the next one
+    std::vector<struct ggml_tensor *> outputs;
+
+    // states saved by the last chunk
+    std::vector<std::vector<float>> states;
+
+    // codes held back until the first chunk has enough frames, [n_q][n_frames]
+    std::vector<int32_t> pending_codes;
+};
+
+// Input for the next state of the stream, NULL on the first chunk
+struct ggml_tensor *encodec_stream_input(struct ggml_context *ctx0, struct encodec_stream *stream,
+                                         int64_t ne0, int64_t ne1);
+
+// Saves a state of the stream for the next chunk
+void encodec_stream_output(struct ggml_context *ctx0, struct encodec_stream *stream,
+                           struct ggml_tensor *state);
+
+// Weights of a convolution [kernel_size, in_channels, out_channels], or of a transposed
+// convolution [kernel_size, out_channels, in_channels]. They are packed as [in_channels,
+// kernel_size, out_channels] for the direct convolutions of the CPU backend when the model is
+// loaded, the convolutions with unpacked weights run as ggml operators.
+struct encodec_conv {
+    struct ggml_tensor *w = NULL;
+    struct ggml_tensor *b = NULL;
+
+    bool packed = false;
+};
+
 struct ggml_tensor *pad_1d(struct ggml_context *ctx0, struct ggml_tensor *inp,
                            int padding_left, int padding_right);
 
@@ -9,9 +49,17 @@ struct ggml_tensor *unpad_1d(struct ggml_context *ctx0, struct ggml_tensor *inp,
                              int padding_left, int padding_right);
 
 struct ggml_tensor *strided_conv_1d(struct ggml_context *ctx0, struct ggml_tensor *inp,
-                                    struct ggml_tensor *conv_w, struct ggml_tensor *conv_b,
-                                    int stride);
+                                    const struct encodec_conv *conv, int stride);
 
 struct ggml_tensor *strided_conv_transpose_1d(struct ggml_context *ctx0, struct ggml_tensor *inp,
-                                              struct ggml_tensor *conv_w, struct ggml_tensor *conv_b,
-                                              int stride);
+                                              const struct encodec_conv *conv, int stride);
+
+// Causal convolutions of a chunk of a stream, which continue from the previous chunk. Without a
+// stream, they are the same as the convolutions above.
+struct ggml_tensor *strided_conv_1d_stream(struct ggml_context *ctx0, struct ggml_tensor *inp,
+                                           const struct encodec_conv *conv, int stride,
+                                           struct encodec_stream *stream);
+
+struct ggml_tensor *strided_conv_transpose_1d_stream(struct ggml_context *ctx0, struct ggml_tensor *inp,
+                                                     const struct encodec_conv *conv, int stride,
+                                                     struct encodec_stream *stream);
@@ -1,22 +1,171 @@
 #pragma once
 
+#include <algorithm>
 #include <cassert>
+#include <cfloat>
 #include <vector>
 
 #include "ggml.h"
 #include "ggml-alloc.h"
 #include "ggml-backend.h"
+#include "ggml-cpu.h"
 
+#include "ops.h"
 #include "utils.h"
 
 struct encodec_quant_block {
     struct ggml_tensor *embed;
+
+    // squared norms of the codewords [n_bins]
+    std::vector<float> norms;
 };
 
 struct encodec_quantizer {
     std::vector<encodec_quant_block> blocks;
 };
 
+// frames quantized together by a thread
+#define ENCODEC_RVQ_TILE 16
+
+// The fused residual vector quantization is a custom operator of the CPU backend, which reads
+// the codebooks in host memory, allocated or mapped from the model file. Other backends run the
+// graph of each codebook.
+static bool encodec_quantizer_use_fused(const struct encodec_quantizer *quantizer) {
+    const struct ggml_tensor *embed = quantizer->blocks[0].embed;
+    return embed->buffer && ggml_backend_buffer_is_host(embed->buffer);
+}
+
+// Computes the squared norms of the codewords once the codebooks are loaded
+void encodec_quantizer_init_norms(struct encodec_quantizer *quantizer) {
+    std::vector<float> embed;
+    for (auto &block : quantizer->blocks) {
+        const int hidden_dim = block.embed->ne[0];
+        const int n_bins     = block.embed->ne[1];
+
+        embed.resize(ggml_nelements(block.embed));
+        ggml_backend_tensor_get(block.embed, embed.data(), 0, ggml_nbytes(block.embed));
+
+        block.norms.resize(n_bins);
+        for (int b = 0; b < n_bins; b++) {
+            const float *e = embed.data() + (size_t) b * hidden_dim;
+            double sum = 0.0;
+            for (int d = 0; d < hidden_dim; d++) {
+                sum += e[d] * e[d];
+            }
+            block.norms[b] = sum;
+        }
+    }
+}
+
+// Residual vector quantization of the frames of encoded [seq_length, hidden_dim] in dst->src[0]
+// into the codes of the n_q codebooks in dst [seq_length, n_q]. Each thread quantizes its own frames by tiles,
+// and the residuals of a tile are compared to one codeword at a time, so that the codebooks are
+// read once per tile. The nearest codeword minimizes |e|^2 - 2 e.r, with the norms of the
+// codewords computed when the model is loaded.
+static void encodec_rvq_encode(struct ggml_tensor *dst, int ith, int nth, void *userdata) {
+    const auto *quantizer = (const struct encodec_quantizer *) userdata;
+    const struct ggml_tensor *encoded = dst->src[0];
+
+    const int seq_length = encoded->ne[0];
+    const int hidden_dim = encoded->ne[1];
+    const int n_q        = dst->ne[1];
+
+    const auto *traits = ggml_get_type_traits_cpu(GGML_TYPE_F32);
+
+    std::vector<float> residual(ENCODEC_RVQ_TILE * hidden_dim);
+    float   best_dist[ENCODEC_RVQ_TILE];
+    int32_t best_code[ENCODEC_RVQ_TILE];
+
+    const int t0 = seq_length * ith / nth;
+    const int t1 = seq_length * (ith + 1) / nth;
+
+    for (int ts = t0; ts < t1; ts += ENCODEC_RVQ_TILE) {
+        const int n = std::min(ENCODEC_RVQ_TILE, t1 - ts);
+
+        for (int i = 0; i < n; i++) {
+            for (int d = 0; d < hidden_dim; d++) {
+                residual[i * hidden_dim + d] = *(const float *) ((const char *) encoded->data + (ts + i) * encoded->nb[0] + d * encoded->nb[1]);
+            }
+        }
+
+        for (int q = 0; q < n_q; q++) {
+            const auto &block = quantizer->blocks[q];
+            const float *embed = (const float *) block.embed->data;
+            const int n_bins = block.embed->ne[1];
+
+            std::fill(best_dist, best_dist + n, FLT_MAX);
+            std::fill(best_code, best_code + n, 0);
+
+            for (int b = 0; b < n_bins; b++) {
+                const float *e = embed + (size_t) b * hidden_dim;
+                for (int i = 0; i < n; i++) {
+                    float dot;
+                    traits->vec_dot(hidden_dim, &dot, 0, e, 0, residual.data() + i * hidden_dim, 0, 1);
+                    const float dist = block.norms[b] - 2.0f * dot;
+                    if (dist < best_dist[i]) {
+                        best_dist[i] = dist;
+                        best_code[i] = b;
+                    }
+                }
+            }
+
+            for (int i = 0; i < n; i++) {
+                const float *e = embed + (size_t) best_code[i] * hidden_dim;
+                float *r = residual.data() + i * hidden_dim;
+                for (int d = 0; d < hidden_dim; d++) {
+                    r[d] -= e[d];
+                }
+                *(int32_t *) ((char *) dst->data + (ts + i) * dst->nb[0] + q * dst->nb[1]) = best_code[i];
+            }
+        }
+    }
+}
+
+// Sums the codewords of the n_q codebooks of each frame of codes [seq_length, n_q] in
+// dst->src[0] into dst [seq_length, hidden_dim], the layout of the input of the decoder. Each
+// thread sums its own frames by tiles, and writes the sums of a tile as runs of consecutive
+// frames. Like ggml_get_rows, a code outside of its codebook aborts, the codes are checked
+// before the graph runs.
+static void encodec_rvq_decode(struct ggml_tensor *dst, int ith, int nth, void *userdata) {
+    const auto *quantizer = (const struct encodec_quantizer *) userdata;
+    const struct ggml_tensor *codes = dst->src[0];
+
+    const int seq_length = codes->ne[0];
+    const int n_q        = codes->ne[1];
+    const int hidden_dim = dst->ne[1];
+
+    std::vector<float> sum(ENCODEC_RVQ_TILE * hidden_dim);
+
+    const int t0 = seq_length * ith / nth;
+    const int t1 = seq_length * (ith + 1) / nth;
+
+    for (int ts = t0; ts < t1; ts += ENCODEC_RVQ_TILE) {
+        const int n = std::min(ENCODEC_RVQ_TILE, t1 - ts);
+
+        std::fill(sum.begin(), sum.end(), 0.0f);
+        for (int q = 0; q < n_q; q++) {
+            const struct ggml_tensor *embed = quantizer->blocks[q].embed;
+            for (int i = 0; i < n; i++) {
+                const int32_t code = *(const int32_t *) ((const char *) codes->data + (ts + i) * codes->nb[0] + q * codes->nb[1]);
+                GGML_ASSERT(code >= 0 && code < embed->ne[1]);
+
+                const float *e = (const float *) ((const char *) embed->data + code * embed->nb[1]);
+                float *s = sum.data() + i * hidden_dim;
+                for (int d = 0; d < hidden_dim; d++) {
+                    s[d] += e[d];
+                }
+            }
+        }
+
+        for (int d = 0; d < hidden_dim; d++) {
+            float *y = (float *) ((char *) dst->data + d * dst->nb[1]);
+            for (int i = 0; i < n; i++) {
+                y[ts + i] = sum[i * hidden_dim + d];
+            }
+        }
+    }
+}
+
 struct ggml_tensor *encodec_forward_quantizer_encode(
     const struct encodec_quantizer *quantizer, struct ggml_context *ctx0,
     struct ggml_tensor *encoded_inp, const int n_bins, const int sr, const int bandwidth,
@@ -32,6 +181,11 @@ struct ggml_tensor *encodec_forward_quantizer_encode(
 
     const int seq_length = encoded_inp->ne[0];
 
+    if (encodec_quantizer_use_fused(quantizer)) {
+        return ggml_custom_4d(ctx0, GGML_TYPE_I32, seq_length, n_q, 1, 1, &encoded_inp, 1,
+                              encodec_rvq_encode, GGML_N_TASKS_MAX, (void *) quantizer);
+    }
+
     struct ggml_tensor *codes = ggml_new_tensor_2d(ctx0, GGML_TYPE_I32, seq_length, n_q);
     ggml_set_input(codes);
 
@@ -40,7 +194,7 @@ struct ggml_tensor *encodec_forward_quantizer_encode(
     struct ggml_tensor *indices;
 
     for (int i = 0; i < n_q; i++) {
-        encodec_quant_block block = quantizer->blocks[i];
+        const encodec_quant_block &block = quantizer->blocks[i];
 
         // compute distance
         // [seq_length, n_bins]
@@ -92,12 +246,17 @@ struct ggml_tensor *encodec_forward_quantizer_decode(
 
     assert(n_q == codes->ne[1]);
 
+    if (encodec_quantizer_use_fused(quantizer)) {
+        return ggml_custom_4d(ctx0, GGML_TYPE_F32, seq_length, hidden_dim, 1, 1, &codes, 1,
+                              encodec_rvq_decode, GGML_N_TASKS_MAX, (void *) quantizer);
+    }
+
     struct ggml_tensor *quantized_out = ggml_new_tensor_2d(ctx0, GGML_TYPE_F32, hidden_dim, seq_length);
     ggml_set_input(quantized_out);
     ggml_set_name(quantized_out, "quantized_out");
 
     for (int i = 0; i < n_q; i++) {
-        encodec_quant_block block = quantizer->blocks[i];
+        const encodec_quant_block &block = quantizer->blocks[i];
 
         struct ggml_tensor *indices = ggml_view_1d(ctx0, codes, seq_length, i * codes->nb[1]);
         struct ggml_tensor *quantized = ggml_get_rows(ctx0, block.embed, indices);
@@ -0,0 +1,155 @@
+// Time the batch-1 matrix products of the Bark GPT models, with the Q4_0 weights in the plain layout
+// and repacked for the aarch64 GEMV kernels, and with Q8_0 weights. The shapes are those of the
+// small (n_embd = 768) and large (n_embd = 1024) models.
+//
+// Usage: bench-gemv [n_threads] [n_iter]
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+#include "ggml-alloc.h"
+#include "ggml-backend.h"
+#include "ggml-cpu.h"
+#include "ggml.h"
+
+static double now_us() {
+    return std::chrono::duration<double, std::micro>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// buffer type repacking the Q4_0 weights, NULL when the CPU has no aarch64 kernels
+static ggml_backend_buffer_type_t repack_buffer_type(ggml_backend_t backend) {
+    if (!ggml_cpu_has_neon()) {
+        return NULL;
+    }
+
+    ggml_backend_dev_t dev = ggml_backend_get_device(backend);
+    auto * get_extra_bufts = (ggml_backend_dev_get_extra_bufts_t) ggml_backend_reg_get_proc_address(
+        ggml_backend_dev_backend_reg(dev), "ggml_backend_dev_get_extra_bufts");
+    for (ggml_backend_buffer_type_t * buft = get_extra_bufts ? get_extra_bufts(dev) : NULL; buft && *buft; buft++) {
+        if (ggml_backend_cpu_buft_is_aarch64(*buft)) {
+            return *buft;
+        }
+    }
+
+    return NULL;
+}
+
+// product of a [n_in, n_out] weight with one token, returns the time of a product in us
+static double bench(ggml_backend_t backend, ggml_backend_buffer_type_t buft, ggml_type type,
+                    int n_in, int n_out, int n_iter, std::vector<float> & out) {
+    struct ggml_init_params params = { 3 * ggml_tensor_overhead() + ggml_graph_overhead(), NULL, true };
+    struct ggml_context * ctx = ggml_init(params);
+
+    struct ggml_tensor * w = ggml_new_tensor_2d(ctx, type, n_in, n_out);
+    struct ggml_tensor * x = ggml_new_tensor_2d(ctx, GGML_TYPE_F32, n_in, 1);
+    struct ggml_tensor * y = ggml_mul_mat(ctx, w, x);
+
+    struct ggml_cgraph * gf = ggml_new_graph(ctx);
+    ggml_build_forward_expand(gf, y);
+
+    ggml_backend_buffer_t buf_w = ggml_backend_alloc_ctx_tensors_from_buft(ctx, buft);
+
+    // the same weights and token for every layout
+    std::mt19937 rng(0);
+    std::normal_distribution<float> normal(0.0f, 0.02f);
+
+    std::vector<float> data(n_in * n_out);
+    for (auto & v : data) {
+        v = normal(rng);
+    }
+    std::vector<uint8_t> q(ggml_nbytes(w));
+    ggml_quantize_chunk(type, data.data(), q.data(), 0, n_out, n_in, NULL);
+    ggml_backend_tensor_set(w, q.data(), 0, q.size());
+
+    std::vector<float> token(n_in);
+    for (auto & v : token) {
+        v = normal(rng) * 50.0f;
+    }
+    ggml_backend_tensor_set(x, token.data(), 0, ggml_nbytes(x));
+
+    ggml_gallocr_t allocr = ggml_gallocr_new(ggml_backend_get_default_buffer_type(backend));
+    ggml_gallocr_alloc_graph(allocr, gf);
+
+    ggml_backend_graph_compute(backend, gf);
+
+    const double t_start = now_us();
+    for (int i = 0; i < n_iter; ++i) {
+        ggml_backend_graph_compute(backend, gf);
+    }
+    const double t_us = (now_us() - t_start) / n_iter;
+
+    out.resize(n_out);
+    ggml_backend_tensor_get(y, out.data(), 0, ggml_nbytes(y));
+
+    ggml_gallocr_free(allocr);
+    ggml_backend_buffer_free(buf_w);
+    ggml_free(ctx);
+
+    return t_us;
+}
+
+int main(int argc, char ** argv) {
+    const int n_threads = argc > 1 ? atoi(argv[1]) : 4;
+    const int n_iter    = argc > 2 ? atoi(argv[2]) : 200;
+
+    ggml_backend_t backend = ggml_backend_cpu_init();
+    ggml_backend_cpu_set_n_threads(backend, n_threads);
+
+    ggml_backend_buffer_type_t buft_plain  = ggml_backend_cpu_buffer_type();
+    ggml_backend_buffer_type_t buft_repack = repack_buffer_type(backend);
+
+    if (!buft_repack) {
+        printf("no aarch64 kernels on this CPU, only the plain layouts are timed\n");
+    }
+
+    struct shape {
+        const char * name;
+        int n_in;
+        int n_out;
+    };
+
+    for (int n_embd : { 768, 1024 }) {
+        const shape shapes[] = {
+            { "c_attn",        n_embd,     3 * n_embd },
+            { "c_proj",        n_embd,     n_embd     },
+            { "mlp c_fc",      n_embd,     4 * n_embd },
+            { "mlp c_proj",    4 * n_embd, n_embd     },
+            { "lm_head text",  n_embd,     10048      },
+            { "lm_head coarse", n_embd,    12096      },
+            { "lm_head fine",  n_embd,     1056       },
+        };
+
+        printf("\nn_embd = %d, %d threads (us per product)\n", n_embd, n_threads);
+        printf("%-16s %12s %8s %8s %8s %10s\n", "", "shape", "q8_0", "q4_0", "repacked", "max diff");
+
+        for (const shape & s : shapes) {
+            std::vector<float> y_q8, y_q4, y_rp;
+
+            const double t_q8 = bench(backend, buft_plain, GGML_TYPE_Q8_0, s.n_in, s.n_out, n_iter, y_q8);
+            const double t_q4 = bench(backend, buft_plain, GGML_TYPE_Q4_0, s.n_in, s.n_out, n_iter, y_q4);
+
+            if (buft_repack) {
+                const double t_rp = bench(backend, buft_repack, GGML_TYPE_Q4_0, s.n_in, s.n_out, n_iter, y_rp);
+
+                // both layouts quantize the token to Q8_0, only the order of the sums differs
+                double max_diff = 0.0;
+                for (int i = 0; i < s.n_out; ++i) {
+                    max_diff = std::max(max_diff, (double) std::fabs(y_rp[i] - y_q4[i]));
+                }
+
+                printf("%-16s %5d x %5d %8.1f %8.1f %8.1f %10.2e\n", s.name, s.n_in, s.n_out, t_q8, t_q4, t_rp, max_diff);
+            } else {
+                printf("%-16s %5d x %5d %8.1f %8.1f %8s %10s\n", s.name, s.n_in, s.n_out, t_q8, t_q4, "-", "-");
+            }
+        }
+    }
+
+    ggml_backend_free(backend);
+
+    return 0;
+}
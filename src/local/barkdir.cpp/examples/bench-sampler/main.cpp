@@ -0,0 +1,94 @@
+// Compare the sampler with the previous sampling path at the semantic and coarse vocabulary sizes.
+//
+// Usage: bench-sampler [n_tokens]
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+#include "sampler.h"
+
+// previous path: copy of the relevant logits, scalar softmax and a new distribution per token
+static void softmax(std::vector<float>& logits) {
+    float maxl = -INFINITY;
+    for (const auto& l : logits)
+        maxl = std::max(maxl, l);
+
+    float sum = 0.0;
+    for (auto& l : logits) {
+        l = exp(l - maxl);
+        sum += l;
+    }
+
+    for (auto& l : logits)
+        l /= sum;
+}
+
+static int reference_sample(const float * logits, int n, std::mt19937 & rng, float temp) {
+    std::vector<float> relevant_logits(logits, logits + n);
+
+    for (int i = 0; i < n; ++i)
+        relevant_logits[i] /= temp;
+
+    softmax(relevant_logits);
+
+    std::discrete_distribution<int> dist(relevant_logits.begin(), relevant_logits.end());
+    return dist(rng);
+}
+
+static double now_us() {
+    return std::chrono::duration<double, std::micro>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+static void bench(const char * name, int n_vocab, int n_tokens, float temp) {
+    std::mt19937 rng(0);
+    std::normal_distribution<float> normal(0.0f, 3.0f);
+
+    // a few different rows of logits, as the model would produce
+    const int n_rows = 16;
+    std::vector<float> logits(n_rows * n_vocab);
+    for (auto & l : logits)
+        l = normal(rng);
+
+    struct bark_sampler sampler;
+
+    // checksum so the samples are not optimized away, and to compare the distributions
+    double t_start = now_us();
+    double mean_ref = 0.0;
+    for (int i = 0; i < n_tokens; ++i)
+        mean_ref += reference_sample(logits.data() + (i % n_rows) * n_vocab, n_vocab, rng, temp);
+    const double t_ref = (now_us() - t_start) / n_tokens;
+
+    t_start = now_us();
+    double mean_new = 0.0;
+    for (int i = 0; i < n_tokens; ++i)
+        mean_new += bark_sampler_sample(sampler, logits.data() + (i % n_rows) * n_vocab, n_vocab, rng, temp, 0, 1.0f, NULL);
+    const double t_new = (now_us() - t_start) / n_tokens;
+
+    t_start = now_us();
+    for (int i = 0; i < n_tokens; ++i)
+        bark_sampler_sample(sampler, logits.data() + (i % n_rows) * n_vocab, n_vocab, rng, temp, 50, 1.0f, NULL);
+    const double t_top_k = (now_us() - t_start) / n_tokens;
+
+    t_start = now_us();
+    for (int i = 0; i < n_tokens; ++i)
+        bark_sampler_sample(sampler, logits.data() + (i % n_rows) * n_vocab, n_vocab, rng, temp, 50, 0.9f, NULL);
+    const double t_top_p = (now_us() - t_start) / n_tokens;
+
+    printf("%-8s n_vocab = %5d: previous %7.2f us, sampler %7.2f us (%.1fx), top-k %7.2f us, top-k + top-p %7.2f us, mean token %.1f / %.1f\n",
+        name, n_vocab, t_ref, t_new, t_ref / t_new, t_top_k, t_top_p, mean_ref / n_tokens, mean_new / n_tokens);
+}
+
+int main(int argc, char ** argv) {
+    const int n_tokens = argc > 1 ? atoi(argv[1]) : 10000;
+
+    bench("semantic", 10001, n_tokens, 0.7f);
+    bench("coarse",    1024, n_tokens, 0.7f);
+    bench("fine",      1024, n_tokens, 0.5f);
+
+    return 0;
+}
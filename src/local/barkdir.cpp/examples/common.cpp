@@ -37,6 +37,10 @@ void bark_print_usage(char** argv, const bark_params& params) {
               << "                        model path (default: " << params.model_path << ")\n"
               << "  -o FNAME, --outwav FNAME\n"
               << "                        output generated wav (default: " << params.dest_wav_path << ")\n"
+              << "  -c DIR, --cache DIR   phrase audio cache directory (default: disabled)\n"
+              << "  -cs N, --cache-size N maximum size of the phrase audio cache in MB (default: " << params.cache_size_mb << ")\n"
+              << "  -w FNAME, --warm FNAME\n"
+              << "                        phrases to generate into the cache at startup, one per line\n"
               << "\n";
 }
 
@@ -54,6 +58,12 @@ int bark_params_parse(int argc, char** argv, bark_params& params) {
             params.seed = std::stoi(argv[++i]);
         } else if (arg == "-o" || arg == "--outwav") {
             params.dest_wav_path = argv[++i];
+        } else if (arg == "-c" || arg == "--cache") {
+            params.cache_dir = argv[++i];
+        } else if (arg == "-cs" || arg == "--cache-size") {
+            params.cache_size_mb = std::stoi(argv[++i]);
+        } else if (arg == "-w" || arg == "--warm") {
+            params.phrases_path = argv[++i];
         } else if (arg == "-h" || arg == "--help") {
             bark_print_usage(argv, params);
             exit(0);
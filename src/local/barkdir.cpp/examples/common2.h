@@ -17,6 +17,15 @@ struct bark_params {
 
     // Seed for reproducibility in token sampling.
     int32_t seed = 0;
+
+    // Directory of the phrase audio cache, empty to disable.
+    std::string cache_dir = "";
+
+    // Maximum size of the phrase audio cache in MB.
+    int32_t cache_size_mb = 256;
+
+    // Phrases generated into the cache at startup, one per line.
+    std::string phrases_path = "";
 };
 
 /**
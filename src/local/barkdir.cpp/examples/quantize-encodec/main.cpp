@@ -0,0 +1,234 @@
+// Quantize the Encodec decoder of a Bark model, and compare its audio with the decoder of the
+// input model on a reference set of codes. The codes are those of a WAV file, or of a synthetic
+// signal, encoded at the bandwidth Bark uses.
+//
+// Usage: quantize-encodec model.bin model-out.bin [q8_0|q5_0|q4_0] [reference.wav]
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "dr_wav.h"
+#include "encodec.h"
+#include "ggml.h"
+
+static double now_ms() {
+    return std::chrono::duration<double, std::milli>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+template <typename T>
+static bool read_value(std::ifstream & fin, T & value) {
+    return (bool) fin.read((char *) &value, sizeof(value));
+}
+
+// offset of the Encodec model, after the vocabulary and the text, coarse and fine models
+static long encodec_offset(const char * fname) {
+    std::ifstream fin(fname, std::ios::binary);
+
+    uint32_t magic;
+    if (!read_value(fin, magic) || magic != GGML_FILE_MAGIC) {
+        return -1;
+    }
+
+    int32_t n_vocab;
+    read_value(fin, n_vocab);
+    for (int i = 0; i < n_vocab; ++i) {
+        uint32_t len;
+        read_value(fin, len);
+        fin.seekg(len, std::ios::cur);
+    }
+
+    for (int m = 0; m < 3; ++m) {
+        fin.seekg(10 * sizeof(int32_t), std::ios::cur);
+
+        int32_t n_tensors;
+        read_value(fin, n_tensors);
+        for (int i = 0; i < n_tensors; ++i) {
+            int32_t n_dims, length, ttype;
+            read_value(fin, n_dims);
+            read_value(fin, length);
+            read_value(fin, ttype);
+
+            int64_t nelements = 1;
+            for (int j = 0; j < n_dims; ++j) {
+                int32_t ne;
+                read_value(fin, ne);
+                nelements *= ne;
+            }
+
+            fin.seekg(length + ggml_row_size((ggml_type) ttype, nelements), std::ios::cur);
+        }
+    }
+
+    return fin ? (long) fin.tellg() : -1;
+}
+
+// a few seconds of harmonics with a moving pitch, and bursts of noise
+static std::vector<float> synthetic_audio(int sample_rate) {
+    std::vector<float> audio(3 * sample_rate);
+
+    uint32_t seed = 1;
+    double phase = 0.0;
+    for (size_t i = 0; i < audio.size(); ++i) {
+        const double t = (double) i / sample_rate;
+        const double f0 = 140.0 + 40.0 * sin(2.0 * M_PI * 0.7 * t);
+        phase += 2.0 * M_PI * f0 / sample_rate;
+
+        double x = 0.0;
+        for (int h = 1; h <= 8; ++h) {
+            x += sin(h * phase) / h;
+        }
+
+        seed = seed * 1664525u + 1013904223u;
+        const double noise = ((seed >> 8) / 16777216.0 - 0.5) * (fmod(t, 0.5) < 0.1 ? 0.5 : 0.02);
+
+        audio[i] = (float) (0.2 * x * (0.6 + 0.4 * sin(2.0 * M_PI * 2.0 * t)) + noise);
+    }
+
+    return audio;
+}
+
+static bool decode(struct encodec_context * ectx, const std::vector<int32_t> & codes, int n_threads,
+                   std::vector<float> & audio, double & t_ms) {
+    // the first run allocates the graph
+    if (!encodec_decompress_audio(ectx, codes.data(), codes.size(), n_threads)) {
+        return false;
+    }
+
+    const double t_start = now_ms();
+    if (!encodec_decompress_audio(ectx, codes.data(), codes.size(), n_threads)) {
+        return false;
+    }
+    t_ms = now_ms() - t_start;
+
+    const float * data = encodec_get_audio(ectx);
+    audio.assign(data, data + encodec_get_audio_size(ectx));
+    return true;
+}
+
+int main(int argc, char ** argv) {
+    if (argc < 3) {
+        fprintf(stderr, "usage: %s model.bin model-out.bin [q8_0|q5_0|q4_0] [reference.wav]\n", argv[0]);
+        return 1;
+    }
+
+    const char * fname_inp = argv[1];
+    const char * fname_out = argv[2];
+    const std::string type = argc > 3 ? argv[3] : "q8_0";
+    const char * fname_wav = argc > 4 ? argv[4] : NULL;
+
+    const int sample_rate = 24000;
+    const int bandwidth   = 6;
+    const int n_threads   = 4;
+
+    ggml_ftype ftype;
+    if (type == "q8_0") {
+        ftype = GGML_FTYPE_MOSTLY_Q8_0;
+    } else if (type == "q5_0") {
+        ftype = GGML_FTYPE_MOSTLY_Q5_0;
+    } else if (type == "q4_0") {
+        ftype = GGML_FTYPE_MOSTLY_Q4_0;
+    } else {
+        fprintf(stderr, "%s: unsupported type '%s'\n", __func__, type.c_str());
+        return 1;
+    }
+
+    // needed to initialize the f16 tables
+    {
+        struct ggml_init_params params = { 0, NULL, false };
+        struct ggml_context * ctx = ggml_init(params);
+        ggml_free(ctx);
+    }
+
+    const long offset = encodec_offset(fname_inp);
+    if (offset < 0) {
+        fprintf(stderr, "%s: invalid Bark model '%s'\n", __func__, fname_inp);
+        return 1;
+    }
+
+    if (!encodec_model_quantize(fname_inp, fname_out, offset, ftype)) {
+        fprintf(stderr, "%s: failed to quantize '%s'\n", __func__, fname_inp);
+        return 1;
+    }
+
+    // reference audio
+    std::vector<float> audio;
+    if (fname_wav) {
+        unsigned int channels, rate;
+        drwav_uint64 n_frames;
+        float * data = drwav_open_file_and_read_pcm_frames_f32(fname_wav, &channels, &rate, &n_frames, NULL);
+        if (!data) {
+            fprintf(stderr, "%s: failed to read '%s'\n", __func__, fname_wav);
+            return 1;
+        }
+        if (rate != (unsigned int) sample_rate) {
+            fprintf(stderr, "%s: '%s' is not sampled at %d Hz\n", __func__, fname_wav, sample_rate);
+            drwav_free(data, NULL);
+            return 1;
+        }
+        audio.resize(n_frames);
+        for (drwav_uint64 i = 0; i < n_frames; ++i) {
+            audio[i] = data[i * channels];
+        }
+        drwav_free(data, NULL);
+    } else {
+        audio = synthetic_audio(sample_rate);
+    }
+
+    struct encodec_context * ectx_ref = encodec_load_model(fname_inp, offset, 0);
+    struct encodec_context * ectx_q   = encodec_load_model(fname_out, offset, 0);
+    if (!ectx_ref || !ectx_q) {
+        fprintf(stderr, "%s: failed to load the models\n", __func__);
+        return 1;
+    }
+
+    for (auto * ectx : { ectx_ref, ectx_q }) {
+        encodec_set_target_bandwidth(ectx, bandwidth);
+        encodec_set_sample_rate(ectx, sample_rate);
+    }
+
+    // reference codes
+    if (!encodec_compress_audio(ectx_ref, audio.data(), audio.size(), n_threads)) {
+        fprintf(stderr, "%s: failed to encode the reference audio\n", __func__);
+        return 1;
+    }
+    const int32_t * data = encodec_get_codes(ectx_ref);
+    const std::vector<int32_t> codes(data, data + encodec_get_codes_size(ectx_ref));
+
+    std::vector<float> audio_ref, audio_q;
+    double t_ref, t_q;
+    if (!decode(ectx_ref, codes, n_threads, audio_ref, t_ref) || !decode(ectx_q, codes, n_threads, audio_q, t_q)) {
+        fprintf(stderr, "%s: failed to decode the reference codes\n", __func__);
+        return 1;
+    }
+
+    if (audio_ref.size() != audio_q.size()) {
+        fprintf(stderr, "%s: decoded %zu samples instead of %zu\n", __func__, audio_q.size(), audio_ref.size());
+        return 1;
+    }
+
+    double signal = 0.0, noise = 0.0, max_err = 0.0;
+    for (size_t i = 0; i < audio_ref.size(); ++i) {
+        const double err = (double) audio_q[i] - audio_ref[i];
+        signal += (double) audio_ref[i] * audio_ref[i];
+        noise  += err * err;
+        max_err = std::max(max_err, std::fabs(err));
+    }
+
+    const double snr = 10.0 * log10(signal / std::max(noise, 1e-30));
+
+    printf("\n");
+    printf("reference: %zu codes, %zu samples\n", codes.size(), audio_ref.size());
+    printf("decode: reference %.1f ms, %s %.1f ms\n", t_ref, type.c_str(), t_q);
+    printf("SNR of the %s decoder: %.2f dB (max error %.5f)\n", type.c_str(), snr, max_err);
+
+    encodec_free(ectx_ref);
+    encodec_free(ectx_q);
+
+    return 0;
+}
@@ -0,0 +1,241 @@
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+#if defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include "sampler.h"
+
+// exp of 4 floats, adapted from the arm limited optimized routine as in ggml
+// the maximum error is 1.45358 plus 0.5 ulps
+#if defined(__ARM_NEON) && defined(__aarch64__)
+
+static inline float32x4_t bark_v_expf(float32x4_t x) {
+    const float32x4_t r = vdupq_n_f32(0x1.8p23f);
+    const float32x4_t z = vfmaq_f32(r, x, vdupq_n_f32(0x1.715476p+0f));
+    const float32x4_t n = vsubq_f32(z, r);
+    const float32x4_t b = vfmsq_f32(vfmsq_f32(x, n, vdupq_n_f32(0x1.62e4p-1f)), n,
+                                    vdupq_n_f32(0x1.7f7d1cp-20f));
+    const uint32x4_t e = vshlq_n_u32(vreinterpretq_u32_f32(z), 23);
+    const float32x4_t k = vreinterpretq_f32_u32(vaddq_u32(e, vreinterpretq_u32_f32(vdupq_n_f32(1))));
+    const uint32x4_t c = vcagtq_f32(n, vdupq_n_f32(126));
+    const float32x4_t u = vmulq_f32(b, b);
+    const float32x4_t j = vfmaq_f32(
+        vmulq_f32(vdupq_n_f32(0x1.ffffecp-1f), b),
+        vfmaq_f32(vfmaq_f32(vdupq_n_f32(0x1.fffdb6p-2f), vdupq_n_f32(0x1.555e66p-3f), b),
+                  vfmaq_f32(vdupq_n_f32(0x1.573e2ep-5f), vdupq_n_f32(0x1.0e4020p-7f), b), u), u);
+    if (!vpaddd_u64(vreinterpretq_u64_u32(c)))
+        return vfmaq_f32(k, j, k);
+    const uint32x4_t d = vandq_u32(vclezq_f32(n), vdupq_n_u32(0x82000000));
+    const float32x4_t s1 = vreinterpretq_f32_u32(vaddq_u32(d, vdupq_n_u32(0x7f000000)));
+    const float32x4_t s2 = vreinterpretq_f32_u32(vsubq_u32(e, d));
+    return vbslq_f32(vcagtq_f32(n, vdupq_n_f32(192)), vmulq_f32(s1, s1),
+                     vbslq_f32(c, vmulq_f32(vfmaq_f32(s2, s2, j), s1), vfmaq_f32(k, k, j)));
+}
+
+#elif defined(__SSE2__)
+
+#define MADD128(x, y, z) _mm_add_ps(_mm_mul_ps(x, y), z)
+#define NMADD128(x, y, z) _mm_sub_ps(z, _mm_mul_ps(x, y))
+
+static inline __m128 bark_v_expf(__m128 x) {
+    const __m128 r = _mm_set1_ps(0x1.8p23f);
+    const __m128 z = MADD128(x, _mm_set1_ps(0x1.715476p+0f), r);
+    const __m128 n = _mm_sub_ps(z, r);
+    const __m128 b =
+        NMADD128(n, _mm_set1_ps(0x1.7f7d1cp-20f), NMADD128(n, _mm_set1_ps(0x1.62e4p-1f), x));
+    const __m128i e = _mm_slli_epi32(_mm_castps_si128(z), 23);
+    const __m128 k = _mm_castsi128_ps(_mm_add_epi32(e, _mm_castps_si128(_mm_set1_ps(1))));
+    const __m128i c =
+        _mm_castps_si128(_mm_cmpgt_ps(_mm_andnot_ps(_mm_set1_ps(-0.f), n), _mm_set1_ps(126)));
+    const __m128 u = _mm_mul_ps(b, b);
+    const __m128 j =
+        MADD128(MADD128(MADD128(_mm_set1_ps(0x1.0e4020p-7f), b, _mm_set1_ps(0x1.573e2ep-5f)), u,
+                        MADD128(_mm_set1_ps(0x1.555e66p-3f), b, _mm_set1_ps(0x1.fffdb6p-2f))),
+                u, _mm_mul_ps(_mm_set1_ps(0x1.ffffecp-1f), b));
+    if (!_mm_movemask_epi8(c))
+        return MADD128(j, k, k);
+    const __m128i g = _mm_and_si128(_mm_castps_si128(_mm_cmple_ps(n, _mm_setzero_ps())),
+                                    _mm_set1_epi32(0x82000000u));
+    const __m128 s1 = _mm_castsi128_ps(_mm_add_epi32(g, _mm_set1_epi32(0x7f000000u)));
+    const __m128 s2 = _mm_castsi128_ps(_mm_sub_epi32(e, g));
+    const __m128i d =
+        _mm_castps_si128(_mm_cmpgt_ps(_mm_andnot_ps(_mm_set1_ps(-0.f), n), _mm_set1_ps(192)));
+    return _mm_or_ps(
+        _mm_and_ps(_mm_castsi128_ps(d), _mm_mul_ps(s1, s1)),
+        _mm_andnot_ps(_mm_castsi128_ps(d),
+                      _mm_or_ps(_mm_and_ps(_mm_castsi128_ps(c), _mm_mul_ps(MADD128(s2, j, s2), s1)),
+                                _mm_andnot_ps(_mm_castsi128_ps(c), MADD128(k, j, k)))));
+}
+
+#endif
+
+static float bark_vec_max(const float * x, int n) {
+    int i = 0;
+    float max = -INFINITY;
+#if defined(__ARM_NEON) && defined(__aarch64__)
+    float32x4_t vmax = vdupq_n_f32(-INFINITY);
+    for (; i + 3 < n; i += 4) {
+        vmax = vmaxq_f32(vmax, vld1q_f32(x + i));
+    }
+    max = vmaxvq_f32(vmax);
+#elif defined(__SSE2__)
+    __m128 vmax = _mm_set1_ps(-INFINITY);
+    for (; i + 3 < n; i += 4) {
+        vmax = _mm_max_ps(vmax, _mm_loadu_ps(x + i));
+    }
+    float tmp[4];
+    _mm_storeu_ps(tmp, vmax);
+    max = std::max(std::max(tmp[0], tmp[1]), std::max(tmp[2], tmp[3]));
+#endif
+    for (; i < n; ++i) {
+        max = std::max(max, x[i]);
+    }
+    return max;
+}
+
+// y = exp((x - max) * scale), returns the sum of y
+static float bark_vec_exp(float * y, const float * x, int n, float max, float scale) {
+    int i = 0;
+    float sum = 0.0f;
+#if defined(__ARM_NEON) && defined(__aarch64__)
+    const float32x4_t vmax   = vdupq_n_f32(max);
+    const float32x4_t vscale = vdupq_n_f32(scale);
+    float32x4_t vsum = vdupq_n_f32(0.0f);
+    for (; i + 3 < n; i += 4) {
+        float32x4_t val = bark_v_expf(vmulq_f32(vsubq_f32(vld1q_f32(x + i), vmax), vscale));
+        vst1q_f32(y + i, val);
+        vsum = vaddq_f32(vsum, val);
+    }
+    sum = vaddvq_f32(vsum);
+#elif defined(__SSE2__)
+    const __m128 vmax   = _mm_set1_ps(max);
+    const __m128 vscale = _mm_set1_ps(scale);
+    __m128 vsum = _mm_setzero_ps();
+    for (; i + 3 < n; i += 4) {
+        __m128 val = bark_v_expf(_mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(x + i), vmax), vscale));
+        _mm_storeu_ps(y + i, val);
+        vsum = _mm_add_ps(vsum, val);
+    }
+    float tmp[4];
+    _mm_storeu_ps(tmp, vsum);
+    sum = (tmp[0] + tmp[1]) + (tmp[2] + tmp[3]);
+#endif
+    for (; i < n; ++i) {
+        y[i] = expf((x[i] - max) * scale);
+        sum += y[i];
+    }
+    return sum;
+}
+
+// draw from the unnormalized probabilities of the candidates with a single pass over their CDF
+template <typename F>
+static int bark_draw(int n, float sum, std::mt19937 & rng, F prob) {
+    std::uniform_real_distribution<float> dist(0.0f, 1.0f);
+    const float u = dist(rng) * sum;
+
+    float acc = 0.0f;
+    for (int i = 0; i < n; ++i) {
+        acc += prob(i);
+        if (acc > u) {
+            return i;
+        }
+    }
+
+    // rounding, pick the last candidate that can be sampled
+    int i = n - 1;
+    while (i > 0 && prob(i) == 0.0f) {
+        --i;
+    }
+    return i;
+}
+
+int32_t bark_sampler_sample(
+        struct bark_sampler & sampler,
+        const float         * logits,
+        int                   n,
+        std::mt19937        & rng,
+        float                 temp,
+        int                   top_k,
+        float                 top_p,
+        float               * eos_p) {
+    auto & probs = sampler.probs;
+    auto & ids   = sampler.ids;
+
+    probs.resize(n);
+
+    // greedy sampling still reports the EOS probability at a temperature of 0.7
+    const float scale = temp == 0.0f ? 1.0f / 0.7f : 1.0f / temp;
+
+    const float max = bark_vec_max(logits, n);
+    const float sum = bark_vec_exp(probs.data(), logits, n, max, scale);
+
+    // likelihood of EOS token
+    if (eos_p) {
+        *eos_p = probs[n - 1] / sum;
+    }
+
+    if (temp == 0.0f) {
+        return std::find(logits, logits + n, max) - logits;
+    }
+
+    const bool use_top_k = top_k > 0 && top_k < n;
+    const bool use_top_p = top_p < 1.0f;
+
+    if (!use_top_k && !use_top_p) {
+        return bark_draw(n, sum, rng, [&](int i) { return probs[i]; });
+    }
+
+    // keep the most likely candidates
+    auto cmp = [&](int32_t a, int32_t b) { return probs[a] > probs[b]; };
+
+    int n_cand = n;
+    if (use_top_k) {
+        // single pass with a min-heap of the k best, most tokens only cost a comparison
+        n_cand = top_k;
+        ids.resize(n_cand);
+        std::iota(ids.begin(), ids.end(), 0);
+        std::make_heap(ids.begin(), ids.end(), cmp);
+        float thold = probs[ids.front()];
+        for (int i = n_cand; i < n; ++i) {
+            if (probs[i] > thold) {
+                std::pop_heap(ids.begin(), ids.end(), cmp);
+                ids.back() = i;
+                std::push_heap(ids.begin(), ids.end(), cmp);
+                thold = probs[ids.front()];
+            }
+        }
+    } else {
+        ids.resize(n);
+        std::iota(ids.begin(), ids.end(), 0);
+    }
+
+    float sum_cand = 0.0f;
+    if (use_top_p) {
+        std::sort(ids.begin(), ids.begin() + n_cand, cmp);
+
+        float total = sum;
+        if (use_top_k) {
+            total = 0.0f;
+            for (int i = 0; i < n_cand; ++i) {
+                total += probs[ids[i]];
+            }
+        }
+
+        int i = 0;
+        do {
+            sum_cand += probs[ids[i++]];
+        } while (i < n_cand && sum_cand < top_p * total);
+        n_cand = i;
+    } else {
+        for (int i = 0; i < n_cand; ++i) {
+            sum_cand += probs[ids[i]];
+        }
+    }
+
+    return ids[bark_draw(n_cand, sum_cand, rng, [&](int i) { return probs[ids[i]]; })];
+}
@@ -0,0 +1,28 @@
+#pragma once
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+// Scratch buffers of the sampler, reused across tokens so sampling does not allocate
+struct bark_sampler {
+    // probabilities of the logits being sampled
+    std::vector<float> probs;
+    // candidate tokens for top-k and top-p sampling
+    std::vector<int32_t> ids;
+};
+
+// Sample a token from n logits
+//   temp:   sampling temperature, 0 picks the most likely token
+//   top_k:  only sample from the k most likely tokens, 0 to disable
+//   top_p:  only sample from the most likely tokens whose probabilities add up to p, 1 to disable
+//   eos_p:  if not NULL, gets the probability of the last token
+int32_t bark_sampler_sample(
+        struct bark_sampler & sampler,
+        const float         * logits,
+        int                   n,
+        std::mt19937        & rng,
+        float                 temp,
+        int                   top_k,
+        float                 top_p,
+        float               * eos_p);
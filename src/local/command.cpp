@@ -0,0 +1,239 @@
+// Recognize spoken commands with grammar-constrained whisper decoding.
+
+#include "command.h"
+#include "image.h"
+#include "face.h"
+#include <ctype.h>
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+// Grammar of the commands the robot understands
+// Whisper text starts with a space, and may be capitalized or end with a full stop
+static const char* command_grammar = R"(
+root      ::= " " command "."?
+command   ::= show | look | face
+show      ::= ("Show" | "show") [a-zA-Z ,']*
+look      ::= (("Look" | "look" | "Move" | "move" | "Turn" | "turn") " ")? direction
+direction ::= "Up" | "up" | "Down" | "down" | "Left" | "left" | "Right" | "right"
+face      ::= "Smile" | "smile" | "Frown" | "frown"
+)";
+
+// Prompt to bias the decoder towards the command words
+static const char* command_prompt = "Show, look up, down, left, right, smile, frown.";
+
+// Keywords for early exit, the same phrases as the grammar
+static const struct { const char* phrase; Command command; } command_keywords[] = {
+    { "show",  COMMAND_SHOW  },
+    { "up",    COMMAND_UP    },
+    { "down",  COMMAND_DOWN  },
+    { "left",  COMMAND_LEFT  },
+    { "right", COMMAND_RIGHT },
+    { "smile", COMMAND_SMILE },
+    { "frown", COMMAND_FROWN },
+};
+static const char* command_verbs[] = { "", "look ", "move ", "turn " };
+
+// Matching state while decoding
+typedef struct {
+    Commands* commands;
+    int node;         // Current trie node, -1 once ruled out
+    int n_tokens;     // Tokens already matched
+    bool space;       // Last character was a space
+    bool done;        // No need to decode further
+    Command command;  // Recognized command
+    std::string text; // Text matched so far
+    float prob;       // Sum of token probabilities
+} CommandMatcher;
+
+static int trie_index(char c) {
+    if (c >= 'a' && c <= 'z') return c - 'a';
+    if (c >= 'A' && c <= 'Z') return c - 'A';
+    return 26;
+}
+
+static void trie_add(std::vector<CommandNode>& trie, const std::string& phrase, Command command) {
+    int node = 0;
+    for (char c : phrase) {
+        const int i = trie_index(c);
+        if (trie[node].next[i] < 0) {
+            CommandNode child;
+            for (int k = 0; k < 27; k++) child.next[k] = -1;
+            child.command = COMMAND_NONE;
+            trie[node].next[i] = trie.size();
+            trie.push_back(child);
+        }
+        node = trie[node].next[i];
+    }
+    trie[node].command = command;
+}
+
+// Walk the trie with each new token, and force the end of text once the command is known
+static void command_logits_filter(struct whisper_context* ctx, struct whisper_state* /*state*/, const whisper_token_data* tokens, int n_tokens, float* logits, void* user_data) {
+    CommandMatcher* m = (CommandMatcher*) user_data;
+    const whisper_token eot = whisper_token_eot(ctx);
+    for (; m->n_tokens < n_tokens && !m->done; m->n_tokens++) {
+        const whisper_token_data& token = tokens[m->n_tokens];
+        if (token.id >= eot) continue;
+        m->prob += token.p;
+        const char* str = whisper_token_to_str(ctx, token.id);
+        m->text += str;
+        if (m->command == COMMAND_SHOW) continue; // Keep decoding the image prompt
+        for (const char* c = str; *c && !m->done; c++) {
+            // Treat punctuation as space, and skip leading and repeated spaces
+            const int i = isalpha((unsigned char) *c) ? trie_index(*c) : 26;
+            if (i == 26 && (m->node == 0 || m->space)) continue;
+            m->space = i == 26;
+
+            // Walk
+            m->node = m->commands->trie[m->node].next[i];
+            if (m->node < 0) {
+                m->done = true;
+                break;
+            }
+
+            // A keyword only matches at the end of a word, so " showing" or " upward" are not commands. The word
+            // ends with this character when the token does, or when the next character is not a letter
+            const Command command = m->commands->trie[m->node].command;
+            if (command == COMMAND_NONE || isalpha((unsigned char) c[1])) continue;
+            m->command = command;
+            if (m->command != COMMAND_SHOW) m->done = true;
+            break;
+        }
+    }
+
+    // Only allow the end of text token
+    if (m->done) {
+        const int n_vocab = whisper_n_vocab(ctx);
+        for (int i = 0; i < n_vocab; i++) if (i != eot) logits[i] = -INFINITY;
+    }
+}
+
+bool create_commands(Commands* commands) {
+    // Parse grammar
+    commands->grammar = grammar_parser::parse(command_grammar);
+    if (commands->grammar.rules.empty()) {
+        fprintf(stderr, "%s: Could not parse command grammar\n", __func__);
+        return false;
+    }
+
+    // Rules
+    commands->rules = commands->grammar.c_rules();
+    commands->start_rule = commands->grammar.symbol_ids.at("root");
+
+    // Keyword trie
+    CommandNode root;
+    for (int k = 0; k < 27; k++) root.next[k] = -1;
+    root.command = COMMAND_NONE;
+    commands->trie.assign(1, root);
+    for (const char* verb : command_verbs) {
+        for (const auto& keyword : command_keywords) {
+            if (verb[0] && keyword.command == COMMAND_SHOW) continue;
+            trie_add(commands->trie, std::string(verb) + keyword.phrase, keyword.command);
+        }
+    }
+
+    commands->early_exit = true;
+    commands->max_tokens = 16;
+    commands->prob_thold = 0.3f;
+    return true;
+}
+
+Command recognize_command(struct whisper_context* ctx, Commands* commands, const float* samples, int n_samples, int n_threads, std::string* text) {
+    // Params
+    whisper_full_params wparams = whisper_full_default_params(WHISPER_SAMPLING_GREEDY);
+    wparams.print_progress   = false;
+    wparams.print_special    = false;
+    wparams.print_realtime   = false;
+    wparams.print_timestamps = false;
+    wparams.no_timestamps    = true;
+    wparams.no_context       = true;
+    wparams.single_segment   = true;
+    wparams.max_tokens       = commands->max_tokens;
+    wparams.language         = "en";
+    wparams.n_threads        = n_threads;
+    wparams.temperature_inc  = 0.0f; // The grammar constrains the output, so no temperature fallback
+    wparams.initial_prompt   = command_prompt;
+    wparams.grammar_rules    = commands->rules.data();
+    wparams.n_grammar_rules  = commands->rules.size();
+    wparams.i_start_rule     = commands->start_rule;
+    wparams.grammar_penalty  = 100.0f;
+
+    // Match keywords while decoding
+    CommandMatcher matcher = { commands, 0, 0, false, false, COMMAND_NONE, "", 0.0f };
+    if (commands->early_exit) {
+        wparams.logits_filter_callback = command_logits_filter;
+        wparams.logits_filter_callback_user_data = &matcher;
+    }
+
+    // Process
+    if (whisper_full(ctx, wparams, samples, n_samples) != 0) {
+        fprintf(stderr, "%s: Failed to process audio\n", __func__);
+        return COMMAND_NONE;
+    }
+
+    // Stopped early
+    if (matcher.done) {
+        if (text) *text = matcher.text;
+        if (matcher.n_tokens == 0 || matcher.prob/matcher.n_tokens < commands->prob_thold) return COMMAND_NONE;
+        return matcher.command;
+    }
+
+    // Get text and average probability of the text tokens
+    std::string result;
+    float prob = 0.0f;
+    int n_tokens = 0;
+    const int n_segments = whisper_full_n_segments(ctx);
+    for (int i = 0; i < n_segments; ++i) {
+        result += whisper_full_get_segment_text(ctx, i);
+        const int token_count = whisper_full_n_tokens(ctx, i);
+        for (int j = 0; j < token_count; ++j) {
+            if (whisper_full_get_token_id(ctx, i, j) >= whisper_token_eot(ctx)) continue;
+            prob += whisper_full_get_token_p(ctx, i, j);
+            n_tokens++;
+        }
+    }
+    if (text) *text = result;
+
+    // Reject unlikely commands
+    if (n_tokens == 0 || prob/n_tokens < commands->prob_thold) return COMMAND_NONE;
+    return command_from_text(result.c_str());
+}
+
+Command command_from_text(const char* text) {
+    // Show first, since the image prompt can contain any word
+    if (strcasestr(text, "show" ) != NULL) return COMMAND_SHOW;
+    if (strcasestr(text, "smile") != NULL) return COMMAND_SMILE;
+    if (strcasestr(text, "frown") != NULL) return COMMAND_FROWN;
+    if (strcasestr(text, "up"   ) != NULL) return COMMAND_UP;
+    if (strcasestr(text, "down" ) != NULL) return COMMAND_DOWN;
+    if (strcasestr(text, "left" ) != NULL) return COMMAND_LEFT;
+    if (strcasestr(text, "right") != NULL) return COMMAND_RIGHT;
+    return COMMAND_NONE;
+}
+
+const char* command_name(Command command) {
+    switch (command) {
+        case COMMAND_SHOW:  return "show";
+        case COMMAND_UP:    return "up";
+        case COMMAND_DOWN:  return "down";
+        case COMMAND_LEFT:  return "left";
+        case COMMAND_RIGHT: return "right";
+        case COMMAND_SMILE: return "smile";
+        case COMMAND_FROWN: return "frown";
+        default:            return "none";
+    }
+}
+
+void run_command(Command command, const char* text) {
+    switch (command) {
+        case COMMAND_SHOW:  create_image(text); break;
+        case COMMAND_UP:    move_head(0, 10); break;
+        case COMMAND_DOWN:  move_head(0, -10); break;
+        case COMMAND_LEFT:  move_head(10, 0); break;
+        case COMMAND_RIGHT: move_head(-10, 0); break;
+        case COMMAND_SMILE: move_face(10); break;
+        case COMMAND_FROWN: move_face(-10); break;
+        default: break;
+    }
+}
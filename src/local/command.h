@@ -0,0 +1,41 @@
+// Spoken commands for the head and face.
+
+#include "whisper.h"
+#include "grammar-parser.h"
+#include <string>
+#include <vector>
+
+// Commands
+typedef enum {
+    COMMAND_NONE,
+    COMMAND_SHOW,
+    COMMAND_UP,
+    COMMAND_DOWN,
+    COMMAND_LEFT,
+    COMMAND_RIGHT,
+    COMMAND_SMILE,
+    COMMAND_FROWN,
+} Command;
+
+// Keyword trie node, over lower case letters and space
+typedef struct {
+    int next[27];    // Child node per character, -1 if none
+    Command command; // Command recognized when reaching this node
+} CommandNode;
+
+// Compiled command grammar and keyword trie
+typedef struct {
+    grammar_parser::parse_state grammar;
+    std::vector<const whisper_grammar_element *> rules;
+    size_t start_rule;
+    std::vector<CommandNode> trie;
+    bool early_exit;  // Stop decoding as soon as a command is recognized or ruled out
+    int max_tokens;   // Decode at most this many tokens per command
+    float prob_thold; // Reject commands with a lower average token probability
+} Commands;
+
+bool create_commands(Commands* commands);
+Command recognize_command(struct whisper_context* ctx, Commands* commands, const float* samples, int n_samples, int n_threads, std::string* text);
+Command command_from_text(const char* text);
+const char* command_name(Command command);
+void run_command(Command command, const char* text);
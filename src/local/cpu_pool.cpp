@@ -0,0 +1,23 @@
+#include "cpu_pool.h"
+#include <algorithm>
+#include <mutex>
+#include <thread>
+
+static std::mutex pool_mutex;
+static struct ggml_threadpool* pool = NULL;
+
+struct ggml_threadpool* shared_cpu_pool(int n_threads) {
+    std::lock_guard<std::mutex> lock(pool_mutex);
+    if (pool) return pool;
+
+    // Keep the threads on the cores, but let the kernel move them between cores as the
+    // face rendering and audio capture threads come and go
+    int n_cores = std::max(1, (int) std::thread::hardware_concurrency());
+    struct ggml_threadpool_params params = ggml_threadpool_params_default(std::max(1, std::min(n_threads, n_cores)));
+    for (int i = 0; i < n_cores && i < GGML_MAX_N_THREADS; i++) params.cpumask[i] = true;
+    params.strict_cpu = false;
+
+    // Lives as long as the process, the models keep using it
+    pool = ggml_threadpool_new(&params);
+    return pool;
+}
@@ -0,0 +1,12 @@
+// Pool of CPU threads shared by speech recognition and speech generation, so running both
+// does not start more threads than the Pi has cores. Whisper, the Bark models with their
+// fine token sampling, and Encodec all compute on it; none of them starts compute threads of its own.
+
+#include "ggml-cpu.h"
+
+// Lanes of the graphs waiting for the pool, the real time speech recognition goes first
+#define CPU_LANE_RECOGNITION 0
+#define CPU_LANE_SYNTHESIS 1
+
+// Pool of the process, created by the first call with at most n_threads threads, one per core
+struct ggml_threadpool* shared_cpu_pool(int n_threads);
@@ -0,0 +1,259 @@
+#include "speech_cache.h"
+#include <algorithm>
+#include <dirent.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+
+// 64 bit FNV-1a
+static uint64_t hash_bytes(uint64_t hash, const void* data, size_t size) {
+    const uint8_t* bytes = (const uint8_t*) data;
+    for (size_t i = 0; i < size; i++) {
+        hash ^= bytes[i];
+        hash *= 0x100000001b3ULL;
+    }
+    return hash;
+}
+
+template <typename T>
+static uint64_t hash_value(uint64_t hash, T value) {
+    return hash_bytes(hash, &value, sizeof(value));
+}
+
+static std::string speech_path(SpeechCache* cache, uint64_t key) {
+    char name[32];
+    snprintf(name, sizeof(name), "%016llx.pcm", (unsigned long long) key);
+    return cache->dir + "/" + name;
+}
+
+static SpeechCacheEntry* find_entry(SpeechCache* cache, uint64_t key) {
+    for (auto& entry : cache->entries) if (entry.key == key) return &entry;
+    return NULL;
+}
+
+static void remove_entry(SpeechCache* cache, uint64_t key) {
+    for (size_t i = 0; i < cache->entries.size(); i++) {
+        if (cache->entries[i].key != key) continue;
+        unlink(speech_path(cache, key).c_str());
+        cache->total_bytes -= cache->entries[i].bytes;
+        cache->entries.erase(cache->entries.begin() + i);
+        return;
+    }
+}
+
+bool open_speech_cache(SpeechCache* cache, const char* dir, const char* model_path, size_t max_bytes) {
+    cache->dir = dir;
+    cache->max_bytes = max_bytes;
+    cache->total_bytes = 0;
+    cache->entries.clear();
+
+    // The model is identified by its path, size and modification time, hashing its contents would take longer than most phrases
+    struct stat st;
+    if (stat(model_path, &st) != 0) {
+        fprintf(stderr, "%s: Could not find model %s\n", __func__, model_path);
+        return false;
+    }
+    cache->model_hash = hash_bytes(0xcbf29ce484222325ULL, model_path, strlen(model_path));
+    cache->model_hash = hash_value(cache->model_hash, (int64_t) st.st_size);
+    cache->model_hash = hash_value(cache->model_hash, (int64_t) st.st_mtime);
+
+    // Create directory
+    if (mkdir(dir, 0755) != 0 && errno != EEXIST) {
+        fprintf(stderr, "%s: Could not create %s\n", __func__, dir);
+        return false;
+    }
+
+    // Index the phrases already cached
+    DIR* d = opendir(dir);
+    if (!d) return false;
+    struct dirent* ent;
+    while ((ent = readdir(d)) != NULL) {
+        unsigned long long key;
+        if (strlen(ent->d_name) != 20 || strcmp(ent->d_name + 16, ".pcm") != 0 || sscanf(ent->d_name, "%16llx", &key) != 1) continue;
+        if (stat(speech_path(cache, key).c_str(), &st) != 0) continue;
+        cache->entries.push_back({ (uint64_t) key, (size_t) st.st_size, (int64_t) st.st_mtime });
+        cache->total_bytes += st.st_size;
+    }
+    closedir(d);
+    return true;
+}
+
+uint64_t speech_cache_key(SpeechCache* cache, const char* text, const bark_context_params* params, uint32_t seed) {
+    // Everything that changes the generated audio, the audio is a function of these as generate_speech() restarts the generator.
+    // Left out: verbosity, n_batch, mmap, threadpool and callbacks
+    uint64_t hash = cache->model_hash;
+    hash = hash_bytes(hash, text, strlen(text) + 1);
+    hash = hash_value(hash, seed);
+
+    // Sampling
+    hash = hash_value(hash, params->temp);
+    hash = hash_value(hash, params->fine_temp);
+    hash = hash_value(hash, params->top_k);
+    hash = hash_value(hash, params->top_p);
+    hash = hash_value(hash, params->min_eos_p);
+    hash = hash_value(hash, params->eos_patience);
+    hash = hash_value(hash, params->sliding_window_size);
+    hash = hash_value(hash, params->max_coarse_history);
+    hash = hash_value(hash, params->n_stream_context);
+    hash = hash_value(hash, (int32_t) params->type_k);
+    hash = hash_value(hash, (int32_t) params->type_v);
+
+    // Audio
+    hash = hash_value(hash, params->sample_rate);
+    hash = hash_value(hash, params->target_bandwidth);
+
+    // Tokens
+    hash = hash_value(hash, params->cls_token_id);
+    hash = hash_value(hash, params->sep_token_id);
+    hash = hash_value(hash, params->n_steps_text_encoder);
+    hash = hash_value(hash, params->text_rate_hz);
+    hash = hash_value(hash, params->text_pad_token);
+    hash = hash_value(hash, params->text_encoding_offset);
+    hash = hash_value(hash, params->semantic_rate_hz);
+    hash = hash_value(hash, params->semantic_pad_token);
+    hash = hash_value(hash, params->semantic_vocab_size);
+    hash = hash_value(hash, params->semantic_infer_token);
+    hash = hash_value(hash, params->coarse_rate_hz);
+    hash = hash_value(hash, params->coarse_infer_token);
+    hash = hash_value(hash, params->coarse_semantic_pad_token);
+    hash = hash_value(hash, params->n_coarse_codebooks);
+    hash = hash_value(hash, params->n_fine_codebooks);
+    hash = hash_value(hash, params->codebook_size);
+    return hash;
+}
+
+bool generate_speech(struct bark_context* bctx, const char* text, uint32_t seed, int n_threads, bark_audio_callback callback, void* user_data) {
+    // Every cached phrase is generated from a fresh generator and through the streaming decoder, so the audio does not depend on
+    // the phrases generated before it or on whether it was warmed or generated on a miss
+    bark_set_seed(bctx, seed);
+    return bark_generate_audio_streaming(bctx, text, n_threads, callback, user_data);
+}
+
+// Collects the audio of a phrase being warmed
+static bool collect_speech(struct bark_context* /*bctx*/, const float* audio, int n_samples, void* user_data) {
+    std::vector<float>* speech = (std::vector<float>*) user_data;
+    speech->insert(speech->end(), audio, audio + n_samples);
+    return true;
+}
+
+bool find_speech(SpeechCache* cache, uint64_t key, CachedSpeech* speech) {
+    SpeechCacheEntry* entry = find_entry(cache, key);
+    if (!entry) return false;
+
+    // Map the file
+    std::string path = speech_path(cache, key);
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        remove_entry(cache, key);
+        return false;
+    }
+    void* map = mmap(NULL, entry->bytes, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (map == MAP_FAILED) return false;
+
+    // Check header, drop files that are damaged or from another version
+    const SpeechCacheHeader* header = (const SpeechCacheHeader*) map;
+    if (entry->bytes < sizeof(SpeechCacheHeader) || header->magic != SPEECH_CACHE_MAGIC || header->version != SPEECH_CACHE_VERSION ||
+        header->key != key || entry->bytes != sizeof(SpeechCacheHeader) + header->n_samples * sizeof(float)) {
+        munmap(map, entry->bytes);
+        fprintf(stderr, "%s: Removing invalid %s\n", __func__, path.c_str());
+        remove_entry(cache, key);
+        return false;
+    }
+
+    speech->samples = (const float*) (header + 1);
+    speech->n_samples = header->n_samples;
+    speech->sample_rate = header->sample_rate;
+    speech->map = map;
+    speech->map_size = entry->bytes;
+
+    // Mark as recently used
+    utimensat(AT_FDCWD, path.c_str(), NULL, 0);
+    entry->last_used = time(NULL);
+    return true;
+}
+
+void release_speech(CachedSpeech* speech) {
+    if (speech->map) munmap(speech->map, speech->map_size);
+    speech->map = NULL;
+    speech->samples = NULL;
+    speech->n_samples = 0;
+}
+
+bool store_speech(SpeechCache* cache, uint64_t key, const float* samples, int n_samples, int sample_rate) {
+    const size_t bytes = sizeof(SpeechCacheHeader) + n_samples * sizeof(float);
+    if (bytes > cache->max_bytes) return false;
+    remove_entry(cache, key);
+
+    // Remove least recently used phrases to make room
+    std::sort(cache->entries.begin(), cache->entries.end(),
+              [](const SpeechCacheEntry& a, const SpeechCacheEntry& b) { return a.last_used < b.last_used; });
+    while (!cache->entries.empty() && cache->total_bytes + bytes > cache->max_bytes) {
+        remove_entry(cache, cache->entries.front().key);
+    }
+
+    // Write to a temporary file and rename, so readers never see a partial file
+    std::string path = speech_path(cache, key);
+    std::string tmp_path = path + ".tmp";
+    FILE* f = fopen(tmp_path.c_str(), "wb");
+    if (!f) {
+        fprintf(stderr, "%s: Could not write %s\n", __func__, tmp_path.c_str());
+        return false;
+    }
+    SpeechCacheHeader header = { SPEECH_CACHE_MAGIC, SPEECH_CACHE_VERSION, key, (uint32_t) sample_rate, (uint32_t) n_samples, 0 };
+    bool ok = fwrite(&header, sizeof(header), 1, f) == 1 && fwrite(samples, sizeof(float), n_samples, f) == (size_t) n_samples;
+    ok = fclose(f) == 0 && ok;
+    if (!ok || rename(tmp_path.c_str(), path.c_str()) != 0) {
+        fprintf(stderr, "%s: Could not write %s\n", __func__, path.c_str());
+        unlink(tmp_path.c_str());
+        return false;
+    }
+
+    cache->entries.push_back({ key, bytes, (int64_t) time(NULL) });
+    cache->total_bytes += bytes;
+    return true;
+}
+
+int warm_speech_cache(SpeechCache* cache, struct bark_context* bctx, const bark_context_params* params, uint32_t seed, const char* phrases_path, int n_threads) {
+    FILE* f = fopen(phrases_path, "r");
+    if (!f) {
+        fprintf(stderr, "%s: Could not open %s\n", __func__, phrases_path);
+        return -1;
+    }
+
+    // Phrases not cached yet, one per line
+    std::vector<std::string> phrases;
+    std::vector<uint64_t> keys;
+    char line[1024];
+    while (fgets(line, sizeof(line), f)) {
+        std::string phrase = line;
+        phrase.erase(phrase.find_last_not_of(" \t\r\n") + 1);
+        phrase.erase(0, phrase.find_first_not_of(" \t"));
+        if (phrase.empty() || phrase[0] == '#') continue;
+        uint64_t key = speech_cache_key(cache, phrase.c_str(), params, seed);
+        if (find_entry(cache, key) || std::find(keys.begin(), keys.end(), key) != keys.end()) continue;
+        phrases.push_back(phrase);
+        keys.push_back(key);
+    }
+    fclose(f);
+    if (phrases.empty()) return 0;
+
+    // Generate and store them one at a time, the same way as a phrase missing from the cache. Batching them would sample them
+    // from other generators and decode them without streaming, so a warmed phrase would differ from one generated on a miss
+    int n_stored = 0;
+    std::vector<float> audio;
+    for (size_t i = 0; i < phrases.size(); i++) {
+        audio.clear();
+        if (!generate_speech(bctx, phrases[i].c_str(), seed, n_threads, collect_speech, &audio)) {
+            fprintf(stderr, "%s: Could not generate phrase %s\n", __func__, phrases[i].c_str());
+            return -1;
+        }
+        if (!audio.empty() && store_speech(cache, keys[i], audio.data(), audio.size(), params->sample_rate)) n_stored++;
+    }
+    return n_stored;
+}
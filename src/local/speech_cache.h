@@ -0,0 +1,52 @@
+// Cache of generated speech, so common phrases play without running Bark.
+
+#include "bark.h"
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+// Audio file of a cached phrase: header followed by the float samples
+#define SPEECH_CACHE_MAGIC 0x63706b62 // "bkpc"
+#define SPEECH_CACHE_VERSION 2
+
+typedef struct {
+    uint32_t magic;
+    uint32_t version;
+    uint64_t key;         // Hash of the phrase, settings and model
+    uint32_t sample_rate;
+    uint32_t n_samples;
+    uint64_t reserved;    // Keeps the samples 32 byte aligned in the mapping
+} SpeechCacheHeader;
+
+// Phrase in the cache directory
+typedef struct {
+    uint64_t key;
+    size_t bytes;
+    int64_t last_used;    // Modification time of the file, touched on every hit
+} SpeechCacheEntry;
+
+// Content addressed cache, one file per phrase named by its key
+typedef struct {
+    std::string dir;
+    size_t max_bytes;     // Least recently used phrases are removed above this size
+    size_t total_bytes;
+    uint64_t model_hash;  // Identity of the model file
+    std::vector<SpeechCacheEntry> entries;
+} SpeechCache;
+
+// Audio of a phrase, mapped read only from the cache
+typedef struct {
+    const float* samples;
+    int n_samples;
+    int sample_rate;
+    void* map;
+    size_t map_size;
+} CachedSpeech;
+
+bool open_speech_cache(SpeechCache* cache, const char* dir, const char* model_path, size_t max_bytes);
+uint64_t speech_cache_key(SpeechCache* cache, const char* text, const bark_context_params* params, uint32_t seed);
+bool generate_speech(struct bark_context* bctx, const char* text, uint32_t seed, int n_threads, bark_audio_callback callback, void* user_data);
+bool find_speech(SpeechCache* cache, uint64_t key, CachedSpeech* speech);
+void release_speech(CachedSpeech* speech);
+bool store_speech(SpeechCache* cache, uint64_t key, const float* samples, int n_samples, int sample_rate);
+int warm_speech_cache(SpeechCache* cache, struct bark_context* bctx, const bark_context_params* params, uint32_t seed, const char* phrases_path, int n_threads);
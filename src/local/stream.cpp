@@ -18,6 +18,9 @@
 #include <unistd.h>
 #include "image.h"
 #include "face.h"
+#include "command.h"
+#include "audio_archive.h"
+#include "cpu_pool.h"
 
 // Command-line parameters
 struct whisper_params {
@@ -28,8 +31,10 @@ struct whisper_params {
     int32_t capture_id = -1;
     int32_t max_tokens = 32;
     int32_t audio_ctx  = 0;
-    float vad_thold    = 0.6f;
+    int32_t vad_hangover_ms = 500;
+    float vad_thold    = 4.0f;
     float freq_thold   = 100.0f;
+    float archive_kbps = 3.0f;   // Bandwidth of the audio archive
     bool translate     = false;
     bool no_fallback   = false;
     bool print_special = false;
@@ -37,11 +42,14 @@ struct whisper_params {
     bool no_timestamps = false;
     bool tinydiarize   = false;
     bool save_audio    = false; // Save audio to wav file
+    bool archive_audio = false; // Save audio to an Encodec archive
     bool use_gpu       = true;
     bool flash_attn    = false;
+    bool commands      = false; // Recognize commands with a grammar instead of transcribing
     std::string language  = "en";
     std::string model     = "../models/ggml-base.en.bin";
     std::string fname_out;
+    std::string encodec_model = "../models/ggml-encodec.bin";
 };
 static bool whisper_params_parse(int argc, char ** argv, whisper_params & params);
 void whisper_print_usage(int argc, char ** argv, const whisper_params & params);
@@ -56,6 +64,7 @@ int mainWhisper(int argc, char ** argv) {
     const int n_samples_len  = (1e-3*params.length_ms)*WHISPER_SAMPLE_RATE;
     const int n_samples_keep = (1e-3*params.keep_ms  )*WHISPER_SAMPLE_RATE;
     const int n_samples_30s  = (1e-3*30000.0         )*WHISPER_SAMPLE_RATE;
+    const int n_samples_pre  = (1e-3*200.0           )*WHISPER_SAMPLE_RATE; // Audio kept before detected speech
     const bool use_vad = n_samples_step <= 0; // Sliding window mode uses VAD
     const int n_new_line = !use_vad ? std::max(1, params.length_ms / params.step_ms - 1) : 1; // Number of steps to print new line
     params.no_timestamps  = !use_vad;
@@ -79,9 +88,15 @@ int mainWhisper(int argc, char ** argv) {
     struct whisper_context_params cparams = whisper_context_default_params();
     cparams.use_gpu    = params.use_gpu;
     cparams.flash_attn = params.flash_attn;
+    cparams.threadpool = shared_cpu_pool(params.n_threads);
+    cparams.threadpool_lane = CPU_LANE_RECOGNITION;
     struct whisper_context * ctx = whisper_init_from_file_with_params(params.model.c_str(), cparams);
     if (!ctx) return -1;
 
+    // Init commands
+    Commands commands;
+    if (params.commands && !create_commands(&commands)) return 1;
+
     // Data
     std::vector<float> pcmf32    (n_samples_30s, 0.0f);
     std::vector<float> pcmf32_old;
@@ -133,6 +148,22 @@ int mainWhisper(int argc, char ** argv) {
         std::string filename = std::string(buffer) + ".wav";
         wavWriter.open(filename, WHISPER_SAMPLE_RATE, 16, 1);
     }
+
+    // Save Encodec archive, about 100 times smaller than the wav file
+    AudioArchiveWriter archive;
+    struct encodec_context * ectx = NULL;
+    if (params.archive_audio) {
+        time_t now = time(0);
+        char buffer[80];
+        strftime(buffer, sizeof(buffer), "%Y%m%d%H%M%S", localtime(&now));
+        std::string filename = std::string(buffer) + ".encz";
+        ectx = encodec_load_model(params.encodec_model.c_str(), 0, 0);
+        if (ectx) encodec_set_threadpool(ectx, shared_cpu_pool(params.n_threads), CPU_LANE_SYNTHESIS); // Archiving waits behind recognition
+        if (!ectx || !open_audio_archive(&archive, filename.c_str(), ectx, params.archive_kbps, WHISPER_SAMPLE_RATE, params.n_threads)) {
+            fprintf(stderr, "%s: failed to open audio archive '%s'!\n", __func__, filename.c_str());
+            return 1;
+        }
+    }
     printf("[Start speaking now]\n");
     fflush(stdout);
 
@@ -140,10 +171,22 @@ int mainWhisper(int argc, char ** argv) {
     auto t_last  = std::chrono::high_resolution_clock::now();
     const auto t_start = t_last;
 
+    // Voice activity detection
+    vad_params vparams;
+    vparams.freq_thold   = params.freq_thold;
+    vparams.speech_ratio = params.vad_thold;
+    vparams.hangover_ms  = params.vad_hangover_ms;
+    vad_stream vad(vparams);
+    std::vector<vad_event> vad_events;
+    int64_t t_read   = audio.position(); // Capture position of the next sample to read
+    int64_t t_vad    = t_read;           // Capture position of the first sample seen by the VAD
+    int64_t t_speech = t_read;           // Capture position where the current utterance started
+
     // Main loop
     while (is_running) {
         // Save audio
-        if (params.save_audio) wavWriter.write(pcmf32_new.data(), pcmf32_new.size());
+        if (params.save_audio && !use_vad) wavWriter.write(pcmf32_new.data(), pcmf32_new.size());
+        if (params.archive_audio && !use_vad) write_audio_archive(&archive, pcmf32_new.data(), pcmf32_new.size());
 
         // Process new audio, if not using Voice Activity Detection
         if (!use_vad) {
@@ -186,33 +229,55 @@ int mainWhisper(int argc, char ** argv) {
             // Set the old audio to the new audio
             pcmf32_old = pcmf32;
         } else {
-            // Get the current time
-            const auto t_now  = std::chrono::high_resolution_clock::now();
-
-            // Get the difference in time
-            const auto t_diff = std::chrono::duration_cast<std::chrono::milliseconds>(t_now - t_last).count();
-
-            // If the difference in time is less than 2000ms, sleep for 100ms
-            if (t_diff < 2000) {
-                std::this_thread::sleep_for(std::chrono::milliseconds(100));
-                continue;
+            // Wait for the next VAD frame
+            std::this_thread::sleep_for(std::chrono::milliseconds(vparams.frame_ms));
+            const auto t_now = std::chrono::high_resolution_clock::now();
+
+            // Copy the audio captured since the last read. A view into the ring is not used here: VAD and the
+            // writers run for longer than the slack the ring keeps, and the capture can overwrite a view meanwhile
+            const int64_t t_new = audio.get_since(t_read, pcmf32_new);
+            if (t_new != t_read) {
+                fprintf(stderr, "\n\n%s: WARNING: cannot process audio fast enough, dropping audio ...\n\n", __func__);
+                vad.reset();
+                t_vad = t_new;
             }
-
-            // Get the audio
-            audio.get(2000, pcmf32_new);
-
-            // Check if the audio is speech
-            if (::vad_simple(pcmf32_new, WHISPER_SAMPLE_RATE, 1000, params.vad_thold, params.freq_thold, false)) {
-                // Get the audio
-                audio.get(params.length_ms, pcmf32);
-            } else {
-                // Sleep for 100ms
-                std::this_thread::sleep_for(std::chrono::milliseconds(100));
-                continue;
+            t_read = t_new + (int64_t) pcmf32_new.size();
+
+            // Save audio
+            if (params.save_audio) wavWriter.write(pcmf32_new.data(), pcmf32_new.size());
+            if (params.archive_audio) write_audio_archive(&archive, pcmf32_new.data(), pcmf32_new.size());
+
+            // Run the VAD on the new audio only
+            vad_events.clear();
+            vad.process(pcmf32_new.data(), pcmf32_new.size(), vad_events);
+            bool speech_done = false;
+            for (const auto & ev : vad_events) {
+                if (ev.type == VAD_EVENT_SPEECH_START) t_speech = t_vad + ev.t_sample;
+                if (ev.type == VAD_EVENT_SPEECH_END)   speech_done = true;
             }
+
+            // Do not let a single utterance outgrow the capture buffer
+            if (!speech_done && vad.is_speech() && t_read - t_speech >= n_samples_len) speech_done = true;
+            if (!speech_done) continue;
+
+            // Get the utterance, from just before speech started until now
+            audio.get_since(std::max(t_speech - n_samples_pre, t_read - n_samples_len), pcmf32);
+            t_speech = t_read;
             t_last = t_now;
         }
 
+        // Recognize a command
+        if (params.commands) {
+            std::string text;
+            const Command command = recognize_command(ctx, &commands, pcmf32.data(), pcmf32.size(), params.n_threads, &text);
+            printf("%s [%s]\n", text.c_str(), command_name(command));
+            fflush(stdout);
+            run_command(command, text.c_str());
+            if (params.fname_out.length() > 0) fout << text << std::endl;
+            ++n_iter;
+            continue;
+        }
+
         // Run the inference
         if (true) {
             // Params
@@ -333,6 +398,10 @@ int mainWhisper(int argc, char ** argv) {
 
     // Done
     audio.pause();
+    if (params.archive_audio) {
+        close_audio_archive(&archive);
+        encodec_free(ectx);
+    }
     whisper_print_timings(ctx);
     whisper_free(ctx);
     return 0;
@@ -354,6 +423,7 @@ static bool whisper_params_parse(int argc, char ** argv, whisper_params & params
         else if (arg == "-mt"   || arg == "--max-tokens")    { params.max_tokens    = std::stoi(argv[++i]); }
         else if (arg == "-ac"   || arg == "--audio-ctx")     { params.audio_ctx     = std::stoi(argv[++i]); }
         else if (arg == "-vth"  || arg == "--vad-thold")     { params.vad_thold     = std::stof(argv[++i]); }
+        else if (arg == "-vho"  || arg == "--vad-hangover")  { params.vad_hangover_ms = std::stoi(argv[++i]); }
         else if (arg == "-fth"  || arg == "--freq-thold")    { params.freq_thold    = std::stof(argv[++i]); }
         else if (arg == "-tr"   || arg == "--translate")     { params.translate     = true; }
         else if (arg == "-nf"   || arg == "--no-fallback")   { params.no_fallback   = true; }
@@ -364,8 +434,12 @@ static bool whisper_params_parse(int argc, char ** argv, whisper_params & params
         else if (arg == "-f"    || arg == "--file")          { params.fname_out     = argv[++i]; }
         else if (arg == "-tdrz" || arg == "--tinydiarize")   { params.tinydiarize   = true; }
         else if (arg == "-sa"   || arg == "--save-audio")    { params.save_audio    = true; }
+        else if (arg == "-aa"   || arg == "--archive-audio") { params.archive_audio = true; }
+        else if (arg == "-abw"  || arg == "--archive-bw")    { params.archive_kbps  = std::stof(argv[++i]); }
+        else if (arg == "-em"   || arg == "--encodec-model") { params.encodec_model = argv[++i]; }
         else if (arg == "-ng"   || arg == "--no-gpu")        { params.use_gpu       = false; }
         else if (arg == "-fa"   || arg == "--flash-attn")    { params.flash_attn    = true; }
+        else if (arg == "-cmd"  || arg == "--commands")      { params.commands      = true; }
 
         else {
             fprintf(stderr, "error: unknown argument: %s\n", arg.c_str());
@@ -390,7 +464,8 @@ void whisper_print_usage(int /*argc*/, char ** argv, const whisper_params & para
     fprintf(stderr, "  -c ID,    --capture ID    [%-7d] capture device ID\n",                              params.capture_id);
     fprintf(stderr, "  -mt N,    --max-tokens N  [%-7d] maximum number of tokens per audio chunk\n",       params.max_tokens);
     fprintf(stderr, "  -ac N,    --audio-ctx N   [%-7d] audio context size (0 - all)\n",                   params.audio_ctx);
-    fprintf(stderr, "  -vth N,   --vad-thold N   [%-7.2f] voice activity detection threshold\n",           params.vad_thold);
+    fprintf(stderr, "  -vth N,   --vad-thold N   [%-7.2f] voice activity detection threshold over noise floor\n", params.vad_thold);
+    fprintf(stderr, "  -vho N,  --vad-hangover N [%-7d] silence in ms that ends an utterance\n",          params.vad_hangover_ms);
     fprintf(stderr, "  -fth N,   --freq-thold N  [%-7.2f] high-pass frequency cutoff\n",                   params.freq_thold);
     fprintf(stderr, "  -tr,      --translate     [%-7s] translate from source language to english\n",      params.translate ? "true" : "false");
     fprintf(stderr, "  -nf,      --no-fallback   [%-7s] do not use temperature fallback while decoding\n", params.no_fallback ? "true" : "false");
@@ -401,8 +476,12 @@ void whisper_print_usage(int /*argc*/, char ** argv, const whisper_params & para
     fprintf(stderr, "  -f FNAME, --file FNAME    [%-7s] text output file name\n",                          params.fname_out.c_str());
     fprintf(stderr, "  -tdrz,    --tinydiarize   [%-7s] enable tinydiarize (requires a tdrz model)\n",     params.tinydiarize ? "true" : "false");
     fprintf(stderr, "  -sa,      --save-audio    [%-7s] save the recorded audio to a file\n",              params.save_audio ? "true" : "false");
+    fprintf(stderr, "  -aa,      --archive-audio [%-7s] save the recorded audio to an Encodec archive\n",    params.archive_audio ? "true" : "false");
+    fprintf(stderr, "  -abw N,   --archive-bw N  [%-7.1f] archive bandwidth in kbps (1.5, 3 or 6)\n",        params.archive_kbps);
+    fprintf(stderr, "  -em FNAME --encodec-model [%-7s] Encodec model for the archive\n",                   params.encodec_model.c_str());
     fprintf(stderr, "  -ng,      --no-gpu        [%-7s] disable GPU inference\n",                          params.use_gpu ? "false" : "true");
     fprintf(stderr, "  -fa,      --flash-attn    [%-7s] flash attention during inference\n",               params.flash_attn ? "true" : "false");
+    fprintf(stderr, "  -cmd,     --commands      [%-7s] recognize head/face commands with a grammar\n",    params.commands ? "true" : "false");
     fprintf(stderr, "\n");
 }
 
@@ -0,0 +1,112 @@
+"""Align the tensor data of a whisper ggml model so it can be used in place when memory mapped.
+
+The legacy whisper ggml format packs tensors without padding, so most tensor data ends up at
+offsets the CPU backend cannot use directly, and whisper.cpp copies those tensors instead.
+This rewrites the file with each tensor name padded with zero bytes, so that every tensor's
+data starts at a multiple of the alignment. The loader strips the padding from the names, and
+the aligned file still loads with the copying loader.
+
+The file is structured as follows:
+    - Magic (`ggml` in binary format)
+    - Hyperparameters   (int[11])
+    - Mel filters       (int n_mel, int n_fft, float[n_mel*n_fft])
+    - Vocabulary        (int n_vocab, then per token: uint length, char[length])
+    - Tensors
+
+For each tensor, the bytes are packed as follows:
+    - Number of dimensions    (int)
+    - Name length             (int)
+    - Type                    (int)
+    - Dimensions              (int[n_dims])
+    - Name                    (char[name_length])
+    - Data
+
+Example
+-------
+```bash
+    python align-ggml.py models/ggml-base.en.bin models/ggml-base.en-aligned.bin
+```
+"""
+import argparse
+import struct
+
+# Block size and bytes per block of the ggml types used by whisper models
+GGML_TYPES = {
+    0: (1, 4),    # F32
+    1: (1, 2),    # F16
+    2: (32, 18),  # Q4_0
+    3: (32, 20),  # Q4_1
+    6: (32, 22),  # Q5_0
+    7: (32, 24),  # Q5_1
+    8: (32, 34),  # Q8_0
+}
+
+parser = argparse.ArgumentParser()
+parser.add_argument("input", type=str, help="ggml model to align")
+parser.add_argument("output", type=str, help="aligned ggml model")
+parser.add_argument("--alignment", type=int, default=32, help="alignment of the tensor data in bytes")
+
+
+def copy(fin, fout, n):
+    data = fin.read(n)
+    if len(data) != n:
+        raise ValueError("Unexpected end of file")
+    fout.write(data)
+    return data
+
+
+def align_model(fin, fout, alignment):
+    # Magic
+    magic = struct.unpack("<I", copy(fin, fout, 4))[0]
+    if magic != 0x67676d6c:
+        raise ValueError("Not a ggml model")
+
+    # Hyperparameters and mel filters
+    copy(fin, fout, 11 * 4)
+    n_mel, n_fft = struct.unpack("<ii", copy(fin, fout, 8))
+    copy(fin, fout, n_mel * n_fft * 4)
+
+    # Vocabulary
+    n_vocab = struct.unpack("<i", copy(fin, fout, 4))[0]
+    for _ in range(n_vocab):
+        length = struct.unpack("<I", copy(fin, fout, 4))[0]
+        copy(fin, fout, length)
+
+    # Tensors
+    n_tensors = 0
+    while True:
+        header = fin.read(12)
+        if len(header) == 0:
+            break
+        n_dims, length, ttype = struct.unpack("<iii", header)
+        if ttype not in GGML_TYPES:
+            raise ValueError("Unsupported tensor type %d" % ttype)
+        dims = fin.read(4 * n_dims)
+        name = fin.read(length)
+
+        n_elements = 1
+        for ne in struct.unpack("<%di" % n_dims, dims):
+            n_elements *= ne
+        block, size = GGML_TYPES[ttype]
+        n_bytes = n_elements // block * size
+
+        # Pad the name so the data starts aligned
+        pad = -(fout.tell() + 12 + len(dims) + length) % alignment
+        name += b"\0" * pad
+
+        fout.write(struct.pack("<iii", n_dims, len(name), ttype))
+        fout.write(dims)
+        fout.write(name)
+        copy(fin, fout, n_bytes)
+        n_tensors += 1
+
+    return n_tensors
+
+
+if __name__ == "__main__":
+    args = parser.parse_args()
+
+    with open(args.input, "rb") as fin, open(args.output, "wb") as fout:
+        n_tensors = align_model(fin, fout, args.alignment)
+
+    print("Aligned %d tensors to %d bytes" % (n_tensors, args.alignment))
@@ -30,6 +30,10 @@ extern "C" {
 
     typedef struct ggml_threadpool * ggml_threadpool_t;
 
+    // A threadpool shared by several threads computes one graph at a time, the others wait in lanes.
+    // When the threadpool is released the graph waiting in the lowest lane goes first.
+    #define GGML_THREADPOOL_MAX_LANES 4
+
     // the compute plan that needs to be prepared for ggml_graph_compute()
     // since https://github.com/ggerganov/ggml/issues/287
     struct ggml_cplan {
@@ -38,6 +42,7 @@ extern "C" {
 
         int n_threads;
         struct ggml_threadpool * threadpool;
+        int lane; // lane waiting for the threadpool, 0 is the most urgent
 
         // abort ggml_graph_compute when true
         ggml_abort_callback abort_callback;
@@ -83,6 +88,8 @@ extern "C" {
     GGML_BACKEND_API int                           ggml_threadpool_get_n_threads(struct ggml_threadpool * threadpool);
     GGML_BACKEND_API void                          ggml_threadpool_pause        (struct ggml_threadpool * threadpool);
     GGML_BACKEND_API void                          ggml_threadpool_resume       (struct ggml_threadpool * threadpool);
+    GGML_BACKEND_API void                          ggml_threadpool_acquire      (struct ggml_threadpool * threadpool, int lane);
+    GGML_BACKEND_API void                          ggml_threadpool_release      (struct ggml_threadpool * threadpool);
 
     // ggml_graph_plan() has to be called before ggml_graph_compute()
     // when plan.work_size > 0, caller must allocate memory for plan.work_data
@@ -161,6 +168,7 @@ extern "C" {
     GGML_BACKEND_API bool ggml_backend_is_cpu                (ggml_backend_t backend);
     GGML_BACKEND_API void ggml_backend_cpu_set_n_threads     (ggml_backend_t backend_cpu, int n_threads);
     GGML_BACKEND_API void ggml_backend_cpu_set_threadpool    (ggml_backend_t backend_cpu, ggml_threadpool_t threadpool);
+    GGML_BACKEND_API void ggml_backend_cpu_set_lane          (ggml_backend_t backend_cpu, int lane);
     GGML_BACKEND_API void ggml_backend_cpu_set_abort_callback(ggml_backend_t backend_cpu, ggml_abort_callback abort_callback, void * abort_callback_data);
 
     GGML_BACKEND_API ggml_backend_reg_t ggml_backend_cpu_reg(void);
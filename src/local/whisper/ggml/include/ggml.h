@@ -496,6 +496,7 @@ extern "C" {
         GGML_OP_POOL_2D_BACK,
         GGML_OP_UPSCALE, // nearest interpolate
         GGML_OP_PAD,
+        GGML_OP_PAD_REFLECT_1D,
         GGML_OP_ARANGE,
         GGML_OP_TIMESTEP_EMBEDDING,
         GGML_OP_ARGSORT,
@@ -524,6 +525,8 @@ extern "C" {
         GGML_OP_MAP_CUSTOM2,
         GGML_OP_MAP_CUSTOM3,
 
+        GGML_OP_CUSTOM,
+
         GGML_OP_CROSS_ENTROPY_LOSS,
         GGML_OP_CROSS_ENTROPY_LOSS_BACK,
         GGML_OP_OPT_STEP_ADAMW,
@@ -1692,6 +1695,13 @@ extern "C" {
             int                  p2,
             int                  p3);
 
+    // pad innermost dimension with reflection: [x, ..., x+n] -> [ ..., x+1, x, x+1, ..., x+n, x+n-1, ...]
+    GGML_API struct ggml_tensor * ggml_pad_reflect_1d(
+            struct ggml_context * ctx,
+            struct ggml_tensor  * a,
+            int                   p0,
+            int                   p1);
+
     // Ref: https://github.com/CompVis/stable-diffusion/blob/main/ldm/modules/diffusionmodules/util.py#L151
     // timesteps: [N,]
     // return: [N, dim]
@@ -1964,6 +1974,23 @@ extern "C" {
             int                     n_tasks,
             void                  * userdata);
 
+    // custom operator with its own type and shape, and up to GGML_MAX_SRC sources in dst->src
+
+    typedef void (*ggml_custom_op_t)(struct ggml_tensor * dst , int ith, int nth, void * userdata);
+
+    GGML_API struct ggml_tensor * ggml_custom_4d(
+            struct ggml_context   * ctx,
+            enum ggml_type          type,
+            int64_t                 ne0,
+            int64_t                 ne1,
+            int64_t                 ne2,
+            int64_t                 ne3,
+            struct ggml_tensor   ** args,
+            int                     n_args,
+            ggml_custom_op_t        fun,
+            int                     n_tasks,
+            void                  * userdata);
+
     // loss function
 
     GGML_API struct ggml_tensor * ggml_cross_entropy_loss(
@@ -3543,15 +3543,16 @@ void ggml_aarch64_repack_tensor(struct ggml_tensor * cur, enum ggml_type repack_
 }
 
 enum ggml_type ggml_aarch64_get_optimal_repack_type(const struct ggml_tensor * cur) {
-    if (cur->type == GGML_TYPE_Q4_0) {
+    // the rows are interleaved by groups of 4 or 8, other shapes keep the plain layout
+    if (cur->type == GGML_TYPE_Q4_0 && ggml_n_dims(cur) == 2) {
         // TODO: enable for AVX2 - currently disabled due to bad gemv performance
-        if (/* ggml_cpu_has_avx2() || */ (ggml_cpu_has_sve() && ggml_cpu_has_matmul_int8() && ggml_cpu_get_sve_cnt() == QK8_0)) {
+        if (/* ggml_cpu_has_avx2() || */ (ggml_cpu_has_sve() && ggml_cpu_has_matmul_int8() && ggml_cpu_get_sve_cnt() == QK8_0) && cur->ne[1] % 8 == 0) {
             return GGML_TYPE_Q4_0_8_8;
         }
-        if (ggml_cpu_has_neon() && ggml_cpu_has_matmul_int8()) {
+        if (ggml_cpu_has_neon() && ggml_cpu_has_matmul_int8() && cur->ne[1] % 4 == 0) {
             return GGML_TYPE_Q4_0_4_8;
         }
-        if (ggml_cpu_has_neon()) {
+        if (ggml_cpu_has_neon() && cur->ne[1] % 4 == 0) {
             return GGML_TYPE_Q4_0_4_4;
         }
     }
@@ -148,6 +148,12 @@ struct ggml_map_custom3_op_params {
     void * userdata;
 };
 
+struct ggml_custom_op_params {
+    ggml_custom_op_t fun;
+    int n_tasks;
+    void * userdata;
+};
+
 // bitset
 
 typedef uint32_t ggml_bitset_t;
@@ -126,6 +126,12 @@ extern "C" {
         struct whisper_aheads dtw_aheads;
 
         size_t dtw_mem_size; // TODO: remove
+
+        bool use_mmap;      // map the model file and use CPU weights in place instead of copying them
+        bool mmap_prefetch; // populate the mapping up front (MAP_POPULATE / madvise WILLNEED)
+
+        struct ggml_threadpool * threadpool; // CPU threadpool shared with other models, NULL to start threads for each graph
+        int threadpool_lane;                 // lane waiting for the shared threadpool, 0 is the most urgent
     };
 
     typedef struct whisper_token_data {
@@ -3,7 +3,9 @@
 audio_async::audio_async(int len_ms) {
     m_len_ms = len_ms;
 
-    m_running = false;
+    m_running   = false;
+    m_audio_pos   = 0;
+    m_audio_clear = 0;
 }
 
 audio_async::~audio_async() {
@@ -75,7 +77,10 @@ bool audio_async::init(int capture_id, int sample_rate) {
 
     m_sample_rate = capture_spec_obtained.freq;
 
-    m_audio.resize((m_sample_rate*m_len_ms)/1000);
+    // one extra second so that readers can work on a view while the callback keeps writing
+    m_audio_len   = (m_sample_rate*m_len_ms)/1000;
+    m_audio_chunk = capture_spec_obtained.samples > 0 ? capture_spec_obtained.samples : 1024;
+    m_audio.resize(m_audio_len + m_sample_rate + m_audio_chunk);
 
     return true;
 }
@@ -127,12 +132,7 @@ bool audio_async::clear() {
         return false;
     }
 
-    {
-        std::lock_guard<std::mutex> lock(m_mutex);
-
-        m_audio_pos = 0;
-        m_audio_len = 0;
-    }
+    m_audio_clear.store(position(), std::memory_order_release);
 
     return true;
 }
@@ -143,34 +143,90 @@ void audio_async::callback(uint8_t * stream, int len) {
         return;
     }
 
-    size_t n_samples = len / sizeof(float);
+    const float * samples   = (const float *) stream;
+    size_t        n_samples = len / sizeof(float);
+
+    // write in chunks so a reader never has more than one chunk in flight over its view
+    while (n_samples > 0) {
+        const size_t n = std::min(n_samples, (size_t) m_audio_chunk);
+
+        // only this thread moves the write position, so it can be read relaxed
+        const int64_t pos = m_audio_pos.load(std::memory_order_relaxed);
+        const size_t  s0  = pos % m_audio.size();
+
+        if (s0 + n > m_audio.size()) {
+            const size_t n0 = m_audio.size() - s0;
+
+            memcpy(&m_audio[s0], samples, n0 * sizeof(float));
+            memcpy(&m_audio[0], samples + n0, (n - n0) * sizeof(float));
+        } else {
+            memcpy(&m_audio[s0], samples, n * sizeof(float));
+        }
 
-    if (n_samples > m_audio.size()) {
-        n_samples = m_audio.size();
+        // publish the new samples to the reader
+        m_audio_pos.store(pos + n, std::memory_order_release);
 
-        stream += (len - (n_samples * sizeof(float)));
+        samples   += n;
+        n_samples -= n;
     }
+}
 
-    //fprintf(stderr, "%s: %zu samples, pos %zu, len %zu\n", __func__, n_samples, m_audio_pos, m_audio_len);
+void audio_async::make_view(int64_t begin, int64_t end, audio_view & view) const {
+    begin = std::max(begin, end - m_audio_len);
+    begin = std::max(begin, m_audio_clear.load(std::memory_order_acquire));
+    begin = std::min(begin, end);
 
-    {
-        std::lock_guard<std::mutex> lock(m_mutex);
+    const size_t n_samples = end - begin;
+    const size_t s0        = begin % m_audio.size();
 
-        if (m_audio_pos + n_samples > m_audio.size()) {
-            const size_t n0 = m_audio.size() - m_audio_pos;
+    view.pos = begin;
 
-            memcpy(&m_audio[m_audio_pos], stream, n0 * sizeof(float));
-            memcpy(&m_audio[0], stream + n0 * sizeof(float), (n_samples - n0) * sizeof(float));
+    if (s0 + n_samples > m_audio.size()) {
+        const size_t n0 = m_audio.size() - s0;
 
-            m_audio_pos = (m_audio_pos + n_samples) % m_audio.size();
-            m_audio_len = m_audio.size();
-        } else {
-            memcpy(&m_audio[m_audio_pos], stream, n_samples * sizeof(float));
+        view.data[0] = &m_audio[s0];
+        view.n[0]    = n0;
+        view.data[1] = &m_audio[0];
+        view.n[1]    = n_samples - n0;
+    } else {
+        view.data[0] = &m_audio[s0];
+        view.n[0]    = n_samples;
+        view.data[1] = nullptr;
+        view.n[1]    = 0;
+    }
+}
 
-            m_audio_pos = (m_audio_pos + n_samples) % m_audio.size();
-            m_audio_len = std::min(m_audio_len + n_samples, m_audio.size());
-        }
+bool audio_async::view(int ms, audio_view & view) const {
+    if (!m_dev_id_in) {
+        fprintf(stderr, "%s: no audio device to get audio from!\n", __func__);
+        return false;
     }
+
+    if (ms <= 0) {
+        ms = m_len_ms;
+    }
+
+    const int64_t end = position();
+
+    make_view(end - ((int64_t) m_sample_rate * ms) / 1000, end, view);
+
+    return true;
+}
+
+bool audio_async::view_since(int64_t pos, audio_view & view) const {
+    if (!m_dev_id_in) {
+        fprintf(stderr, "%s: no audio device to get audio from!\n", __func__);
+        return false;
+    }
+
+    make_view(pos, position(), view);
+
+    return true;
+}
+
+bool audio_async::valid(const audio_view & view) const {
+    // the callback may be writing up to one chunk past the published position
+    return position() + m_audio_chunk <= view.pos + (int64_t) m_audio.size();
 }
 
 void audio_async::get(int ms, std::vector<float> & result) {
@@ -184,36 +240,44 @@ void audio_async::get(int ms, std::vector<float> & result) {
         return;
     }
 
-    result.clear();
-
-    {
-        std::lock_guard<std::mutex> lock(m_mutex);
+    audio_view v;
+    do {
+        view(ms, v);
 
-        if (ms <= 0) {
-            ms = m_len_ms;
+        result.resize(v.size());
+        memcpy(result.data(), v.data[0], v.n[0] * sizeof(float));
+        if (v.n[1] > 0) {
+            memcpy(&result[v.n[0]], v.data[1], v.n[1] * sizeof(float));
         }
 
-        size_t n_samples = (m_sample_rate * ms) / 1000;
-        if (n_samples > m_audio_len) {
-            n_samples = m_audio_len;
-        }
+        // keep the reads of the copy before the position checked by valid()
+        std::atomic_thread_fence(std::memory_order_acquire);
+    } while (!valid(v));
+}
 
-        result.resize(n_samples);
+int64_t audio_async::get_since(int64_t pos, std::vector<float> & result) {
+    result.clear();
 
-        int s0 = m_audio_pos - n_samples;
-        if (s0 < 0) {
-            s0 += m_audio.size();
-        }
+    if (!m_dev_id_in) {
+        fprintf(stderr, "%s: no audio device to get audio from!\n", __func__);
+        return pos;
+    }
 
-        if (s0 + n_samples > m_audio.size()) {
-            const size_t n0 = m_audio.size() - s0;
+    audio_view v;
+    do {
+        view_since(pos, v);
 
-            memcpy(result.data(), &m_audio[s0], n0 * sizeof(float));
-            memcpy(&result[n0], &m_audio[0], (n_samples - n0) * sizeof(float));
-        } else {
-            memcpy(result.data(), &m_audio[s0], n_samples * sizeof(float));
+        result.resize(v.size());
+        memcpy(result.data(), v.data[0], v.n[0] * sizeof(float));
+        if (v.n[1] > 0) {
+            memcpy(&result[v.n[0]], v.data[1], v.n[1] * sizeof(float));
         }
-    }
+
+        // keep the reads of the copy before the position checked by valid()
+        std::atomic_thread_fence(std::memory_order_acquire);
+    } while (!valid(v));
+
+    return v.pos;
 }
 
 bool sdl_poll_events() {
@@ -4,14 +4,23 @@
 #include <SDL_audio.h>
 
 #include <atomic>
+#include <cstddef>
 #include <cstdint>
 #include <vector>
-#include <mutex>
 
 //
 // SDL Audio capture
 //
 
+// zero-copy view into the capture buffer, made of up to two contiguous spans
+struct audio_view {
+    int64_t       pos     = 0; // position of the first sample
+    const float * data[2] = { nullptr, nullptr };
+    size_t        n[2]    = { 0, 0 };
+
+    size_t size() const { return n[0] + n[1]; }
+};
+
 class audio_async {
 public:
     audio_async(int len_ms);
@@ -21,6 +30,7 @@ public:
 
     // start capturing audio via the provided SDL callback
     // keep last len_ms seconds of audio in a circular buffer
+    // the buffer is a single-producer single-consumer ring: the SDL callback never blocks on readers
     bool resume();
     bool pause();
     bool clear();
@@ -31,18 +41,36 @@ public:
     // get audio data from the circular buffer
     void get(int ms, std::vector<float> & audio);
 
+    // get the audio captured since position pos (clamped to the last len_ms), returns the position of the first sample
+    int64_t get_since(int64_t pos, std::vector<float> & audio);
+
+    // position of the next sample to be captured, increases monotonically
+    int64_t position() const { return m_audio_pos.load(std::memory_order_acquire); }
+
+    // zero-copy views of the last ms of audio, or of the audio captured since position pos
+    // the spans point into the circular buffer and are only valid while valid(view) is true,
+    // callers copying from the spans must put std::atomic_thread_fence(std::memory_order_acquire)
+    // between the copy and valid(view), otherwise the reads of the copy may move after the check
+    bool view(int ms, audio_view & view) const;
+    bool view_since(int64_t pos, audio_view & view) const;
+    bool valid(const audio_view & view) const;
+
 private:
+    void make_view(int64_t begin, int64_t end, audio_view & view) const;
+
     SDL_AudioDeviceID m_dev_id_in = 0;
 
     int m_len_ms = 0;
     int m_sample_rate = 0;
 
     std::atomic_bool m_running;
-    std::mutex       m_mutex;
 
     std::vector<float> m_audio;
-    size_t             m_audio_pos = 0;
-    size_t             m_audio_len = 0;
+    int64_t            m_audio_len   = 0; // samples in len_ms, the rest of the buffer is headroom for readers
+    int64_t            m_audio_chunk = 0; // largest write done by a single callback
+
+    std::atomic<int64_t> m_audio_pos;     // written by the callback only
+    std::atomic<int64_t> m_audio_clear;   // written by the reader only
 };
 
 // Return false if need to quit
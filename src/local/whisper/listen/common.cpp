@@ -798,6 +798,91 @@ bool vad_simple(std::vector<float> & pcmf32, int sample_rate, int last_ms, float
     return true;
 }
 
+vad_stream::vad_stream(const vad_params & params) : m_params(params) {
+    m_frame_len    = std::max(1, (m_params.sample_rate*m_params.frame_ms)/1000);
+    m_onset_frames = std::max(1, m_params.onset_ms   /std::max(1, m_params.frame_ms));
+    m_hang_frames  = std::max(1, m_params.hangover_ms/std::max(1, m_params.frame_ms));
+
+    if (m_params.freq_thold > 0.0f) {
+        const float rc = 1.0f / (2.0f * M_PI * m_params.freq_thold);
+        const float dt = 1.0f / m_params.sample_rate;
+        m_hp_alpha = rc / (rc + dt);
+    }
+
+    m_frame.reserve(m_frame_len);
+}
+
+void vad_stream::reset() {
+    m_hp_x      = 0.0f;
+    m_hp_y      = 0.0f;
+    m_floor     = -1.0f;
+    m_speech    = false;
+    m_run       = 0;
+    m_run_start = 0;
+    m_n_samples = 0;
+    m_frame.clear();
+}
+
+void vad_stream::process(const float * samples, size_t n_samples, std::vector<vad_event> & events) {
+    for (size_t i = 0; i < n_samples; i++) {
+        float x = samples[i];
+
+        if (m_params.freq_thold > 0.0f) {
+            m_hp_y = m_hp_alpha * (m_hp_y + x - m_hp_x);
+            m_hp_x = x;
+            x = m_hp_y;
+        }
+
+        m_frame.push_back(x);
+
+        if ((int) m_frame.size() == m_frame_len) {
+            process_frame(events);
+            m_n_samples += m_frame_len;
+            m_frame.clear();
+        }
+    }
+}
+
+void vad_stream::process_frame(std::vector<vad_event> & events) {
+    float energy = 0.0f;
+    for (int i = 0; i < m_frame_len; i++) {
+        energy += m_frame[i]*m_frame[i];
+    }
+    energy /= m_frame_len;
+
+    if (m_floor < 0.0f) {
+        m_floor = energy;
+    }
+
+    const bool active = energy > m_params.energy_min && energy > m_params.speech_ratio*m_floor;
+
+    // only adapt the noise floor on frames that do not look like speech
+    if (!active) {
+        const float rate = energy < m_floor ? m_params.floor_down : m_params.floor_up;
+        m_floor += rate*(energy - m_floor);
+    }
+
+    if (active == m_speech) {
+        m_run = 0;
+        return;
+    }
+
+    if (m_run == 0) {
+        m_run_start = m_n_samples;
+    }
+    m_run++;
+
+    if (!m_speech && m_run >= m_onset_frames) {
+        m_speech = true;
+        m_run    = 0;
+        events.push_back({ VAD_EVENT_SPEECH_START, m_run_start });
+    } else if (m_speech && m_run >= m_hang_frames) {
+        m_speech = false;
+        m_run    = 0;
+        events.push_back({ VAD_EVENT_SPEECH_END, m_run_start });
+    }
+}
+
 float similarity(const std::string & s0, const std::string & s1) {
     const size_t len0 = s0.size() + 1;
     const size_t len1 = s1.size() + 1;
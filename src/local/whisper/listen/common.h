@@ -263,6 +263,74 @@ bool vad_simple(
         float freq_thold,
         bool  verbose);
 
+// Streaming voice activity detection (VAD)
+//
+//   - audio is pushed in arbitrary sized chunks and analyzed once in frames of frame_ms
+//   - the high-pass filter state is carried across calls
+//   - the background noise floor is tracked on non-speech frames
+//   - a frame is speech when its energy exceeds speech_ratio times the noise floor
+//   - onset_ms of speech raise a start event, hangover_ms of silence raise an end event
+//
+struct vad_params {
+    int   sample_rate  = COMMON_SAMPLE_RATE;
+    int   frame_ms     = 20;      // analysis frame length, 10 - 30 ms
+    float freq_thold   = 100.0f;  // high-pass cutoff in Hz (0 - disabled)
+    float speech_ratio = 4.0f;    // frame energy over noise floor to count as speech
+    float energy_min   = 1e-6f;   // frames below this energy are never speech
+    float floor_up     = 0.01f;   // noise floor adaptation rate when energy rises
+    float floor_down   = 0.2f;    // noise floor adaptation rate when energy falls
+    int   onset_ms     = 60;      // speech required before a start event
+    int   hangover_ms  = 500;     // silence required before an end event
+};
+
+enum vad_event_type {
+    VAD_EVENT_SPEECH_START,
+    VAD_EVENT_SPEECH_END,
+};
+
+struct vad_event {
+    vad_event_type type;
+    int64_t        t_sample; // absolute sample position of the speech boundary
+};
+
+class vad_stream {
+public:
+    vad_stream(const vad_params & params = vad_params());
+
+    // analyze new samples, append any start/end of speech events to events
+    void process(const float * samples, size_t n_samples, std::vector<vad_event> & events);
+
+    // forget all state, including the noise floor
+    void reset();
+
+    bool    is_speech()      const { return m_speech; }
+    float   noise_floor()    const { return m_floor; }
+    int64_t n_samples()      const { return m_n_samples; }
+
+private:
+    void process_frame(std::vector<vad_event> & events);
+
+    vad_params m_params;
+
+    int   m_frame_len    = 0;
+    int   m_onset_frames = 0;
+    int   m_hang_frames  = 0;
+    float m_hp_alpha     = 0.0f;
+
+    // high-pass filter state
+    float m_hp_x = 0.0f;
+    float m_hp_y = 0.0f;
+
+    // partial frame
+    std::vector<float> m_frame;
+
+    float   m_floor      = -1.0f;
+    bool    m_speech     = false;
+    int     m_run        = 0;  // consecutive frames disagreeing with the current state
+    int64_t m_run_start  = 0;  // sample position where that run started
+    int64_t m_n_samples  = 0;  // samples processed so far
+};
+
 // compute similarity between two strings using Levenshtein distance
 float similarity(const std::string & s0, const std::string & s1);
 
@@ -24,6 +24,7 @@
 #include <cstring>
 #include <fstream>
 #include <map>
+#include <memory>
 #include <set>
 #include <string>
 #include <thread>
@@ -37,6 +38,16 @@
 #pragma warning(disable: 4244 4267) // possible loss of data
 #endif
 
+#if defined(__unix__) || defined(__APPLE__)
+#include <unistd.h>
+#if defined(_POSIX_MAPPED_FILES) && !defined(GGML_BIG_ENDIAN)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#define WHISPER_USE_MMAP
+#endif
+#endif
+
 #if defined(GGML_BIG_ENDIAN)
 #include <bit>
 
@@ -681,6 +692,79 @@ struct whisper_kv_cache {
     std::vector<uint8_t> ctx_buf;
 };
 
+// read-only mapping of a model file
+//
+// the pages are shared with the page cache and other processes mapping the same file,
+// so CPU weights that are suitably aligned in the file can be used in place
+//
+struct whisper_mmap {
+    void * addr = nullptr;
+    size_t size = 0;
+    size_t pos  = 0; // read position of the model loader
+
+    whisper_mmap() = default;
+    whisper_mmap(const whisper_mmap &) = delete;
+    whisper_mmap & operator=(const whisper_mmap &) = delete;
+
+#ifdef WHISPER_USE_MMAP
+    bool open(const char * fname, bool prefetch) {
+        const int fd = ::open(fname, O_RDONLY);
+        if (fd < 0) {
+            return false;
+        }
+
+        struct stat st;
+        if (fstat(fd, &st) != 0 || st.st_size == 0) {
+            ::close(fd);
+            return false;
+        }
+
+        int flags = MAP_SHARED;
+#ifdef __linux__
+        if (prefetch) {
+            flags |= MAP_POPULATE;
+        }
+#endif
+        void * ptr = mmap(nullptr, st.st_size, PROT_READ, flags, fd, 0);
+        ::close(fd);
+        if (ptr == MAP_FAILED) {
+            return false;
+        }
+
+        if (prefetch) {
+            posix_madvise(ptr, st.st_size, POSIX_MADV_WILLNEED);
+        }
+
+        addr = ptr;
+        size = st.st_size;
+        pos  = 0;
+
+        return true;
+    }
+
+    ~whisper_mmap() {
+        if (addr) {
+            munmap(addr, size);
+        }
+    }
+#else
+    bool open(const char * /*fname*/, bool /*prefetch*/) {
+        return false;
+    }
+#endif
+};
+
+static size_t whisper_mmap_read(void * ctx, void * output, size_t read_size) {
+    whisper_mmap * mm = (whisper_mmap *) ctx;
+
+    const size_t n = std::min(read_size, mm->size - std::min(mm->pos, mm->size));
+
+    memcpy(output, (const char *) mm->addr + mm->pos, n);
+    mm->pos += read_size;
+
+    return n;
+}
+
 struct whisper_model {
     e_model type = MODEL_UNKNOWN;
 
@@ -721,6 +805,13 @@ struct whisper_model {
     // the model backend data is read-only and can be shared between processors
     ggml_backend_buffer_t buffer = nullptr;
 
+    // weights used in place from the memory mapped model file
+    ggml_backend_buffer_t buffer_mapped = nullptr;
+    std::unique_ptr<whisper_mmap> mapping;
+
+    // Q4_0 weights of the matrix products, repacked for the aarch64 kernels
+    ggml_backend_buffer_t buffer_repacked = nullptr;
+
     // tensors
     int n_loaded;
     std::map<std::string, struct ggml_tensor *> tensors;
@@ -1273,9 +1364,13 @@ static std::vector<ggml_backend_t> whisper_backend_init(const whisper_context_pa
         }
     }
 
-    GGML_UNUSED(params);
+    ggml_backend_t backend_cpu = ggml_backend_cpu_init();
+    if (params.threadpool) {
+        ggml_backend_cpu_set_threadpool(backend_cpu, params.threadpool);
+        ggml_backend_cpu_set_lane(backend_cpu, params.threadpool_lane);
+    }
 
-    result.push_back(ggml_backend_cpu_init());
+    result.push_back(backend_cpu);
 
     return result;
 }
@@ -1297,6 +1392,160 @@ static ggml_backend_buffer_type_t whisper_default_buffer_type(const whisper_cont
     return ggml_backend_cpu_buffer_type();
 }
 
+// buffer type repacking Q4_0 weights at load into the interleaved layout of the aarch64 GEMV and GEMM kernels
+// returns nullptr when the CPU has no such kernels
+static ggml_backend_buffer_type_t whisper_repack_buffer_type() {
+    if (!ggml_cpu_has_neon()) {
+        return nullptr;
+    }
+
+    ggml_backend_dev_t dev = ggml_backend_dev_by_type(GGML_BACKEND_DEVICE_TYPE_CPU);
+    auto * get_extra_bufts = dev ? (ggml_backend_dev_get_extra_bufts_t) ggml_backend_reg_get_proc_address(
+        ggml_backend_dev_backend_reg(dev), "ggml_backend_dev_get_extra_bufts") : nullptr;
+    if (!get_extra_bufts) {
+        return nullptr;
+    }
+
+    for (ggml_backend_buffer_type_t * buft = get_extra_bufts(dev); *buft; buft++) {
+        if (ggml_backend_cpu_buft_is_aarch64(*buft)) {
+            return *buft;
+        }
+    }
+
+    return nullptr;
+}
+
+// allocate the Q4_0 weights only used by matrix products in the repacking buffer, so the decoding steps,
+// which multiply them with a single token, run on the GEMV kernels
+//
+// returns the number of repacked tensors
+//
+static int whisper_model_repack_tensors(whisper_model & model) {
+    ggml_backend_buffer_type_t buft = whisper_repack_buffer_type();
+    if (!buft) {
+        return 0;
+    }
+
+    std::vector<ggml_tensor *> repacked;
+    for (const auto & layer : model.layers_encoder) {
+        for (ggml_tensor * t : { layer.attn_q_w, layer.attn_k_w, layer.attn_v_w, layer.attn_ln_1_w, layer.mlp_0_w, layer.mlp_1_w }) {
+            if (t->type == GGML_TYPE_Q4_0) {
+                repacked.push_back(t);
+            }
+        }
+    }
+    for (const auto & layer : model.layers_decoder) {
+        for (ggml_tensor * t : { layer.attn_q_w, layer.attn_k_w, layer.attn_v_w, layer.attn_ln_1_w,
+                                 layer.cross_attn_q_w, layer.cross_attn_k_w, layer.cross_attn_v_w, layer.cross_attn_ln_1_w,
+                                 layer.mlp_0_w, layer.mlp_1_w }) {
+            if (t->type == GGML_TYPE_Q4_0) {
+                repacked.push_back(t);
+            }
+        }
+    }
+
+    if (repacked.empty()) {
+        return 0;
+    }
+
+    const size_t alignment = ggml_backend_buft_get_alignment(buft);
+
+    size_t size = 0;
+    for (ggml_tensor * t : repacked) {
+        size += GGML_PAD(ggml_backend_buft_get_alloc_size(buft, t), alignment);
+    }
+
+    model.buffer_repacked = ggml_backend_buft_alloc_buffer(buft, size);
+    if (!model.buffer_repacked) {
+        WHISPER_LOG_WARN("%s: failed to allocate the repacked weights, using the plain layout\n", __func__);
+        return 0;
+    }
+
+    struct ggml_tallocr alloc = ggml_tallocr_new(model.buffer_repacked);
+    for (ggml_tensor * t : repacked) {
+        ggml_tallocr_alloc(&alloc, t);
+    }
+
+    WHISPER_LOG_INFO("%s: repacked %zu tensors for %s (%.2f MB)\n", __func__, repacked.size(), ggml_backend_buft_name(buft), size/1e6);
+
+    return (int) repacked.size();
+}
+
+// point the model tensors at their data in the memory mapped model file
+//
+// only tensors stored with the expected type and whose data is aligned for the CPU backend are mapped,
+// the others are left unallocated and get copied from the mapping by whisper_model_load()
+// the loader position is not changed
+//
+// returns the number of mapped tensors
+//
+static int whisper_model_map_tensors(whisper_mmap & mapping, whisper_model & model) {
+    model.buffer_mapped = ggml_backend_cpu_buffer_from_ptr(mapping.addr, mapping.size);
+
+    const size_t alignment = ggml_backend_buffer_get_alignment(model.buffer_mapped);
+    const char * base = (const char *) mapping.addr;
+
+    int    n_mapped    = 0;
+    size_t size_mapped = 0;
+    size_t pos         = mapping.pos;
+
+    while (pos + 3*sizeof(int32_t) <= mapping.size) {
+        int32_t hdr[3]; // n_dims, length, ttype
+        memcpy(hdr, base + pos, sizeof(hdr));
+        pos += sizeof(hdr);
+
+        const int32_t n_dims = hdr[0];
+        const int32_t length = hdr[1];
+        const int32_t ttype  = hdr[2];
+
+        if (n_dims < 1 || n_dims > 4 || length <= 0 || ttype < 0 || ttype >= GGML_TYPE_COUNT) {
+            break;
+        }
+
+        int64_t nelements = 1;
+        for (int i = 0; i < n_dims; ++i) {
+            int32_t ne = 0;
+            memcpy(&ne, base + pos + i*sizeof(int32_t), sizeof(ne));
+            nelements *= ne;
+        }
+        pos += n_dims*sizeof(int32_t);
+
+        if (pos + length > mapping.size) {
+            break;
+        }
+
+        const std::string name(base + pos, strnlen(base + pos, length));
+        pos += length;
+
+        const size_t nbytes = (nelements*ggml_type_size(ggml_type(ttype)))/ggml_blck_size(ggml_type(ttype));
+        if (pos + nbytes > mapping.size) {
+            break;
+        }
+
+        auto it = model.tensors.find(name);
+        if (it != model.tensors.end()) {
+            ggml_tensor * tensor = it->second;
+
+            if (tensor->type == ttype && ggml_nbytes(tensor) == nbytes && tensor->data == nullptr && pos % alignment == 0) {
+                ggml_backend_tensor_alloc(model.buffer_mapped, tensor, (void *) (base + pos));
+                n_mapped++;
+                size_mapped += nbytes;
+            }
+        }
+
+        pos += nbytes;
+    }
+
+    WHISPER_LOG_INFO("%s: mapped %d of %zu tensors in place (%.2f MB)\n", __func__, n_mapped, model.tensors.size(), size_mapped/1e6);
+
+    if (n_mapped == 0) {
+        ggml_backend_buffer_free(model.buffer_mapped);
+        model.buffer_mapped = nullptr;
+    }
+
+    return n_mapped;
+}
+
 // load the model from a ggml file
 //
 // file format:
@@ -1721,15 +1970,32 @@ static bool whisper_model_load(struct whisper_model_loader * loader, whisper_con
         }
     }
 
-    // allocate tensors in the backend buffers
-    model.buffer = ggml_backend_alloc_ctx_tensors_from_buft(model.ctx, whisper_default_buffer_type(wctx.params));
-    if (!model.buffer) {
-        WHISPER_LOG_ERROR("%s: failed to allocate memory for the model\n", __func__);
-        return false;
+    ggml_backend_buffer_type_t buft = whisper_default_buffer_type(wctx.params);
+
+    whisper_mmap * mapping = loader->read == whisper_mmap_read ? (whisper_mmap *) loader->context : nullptr;
+    int n_allocated = 0;
+
+    // the repacked weights are copied from the file, they cannot be used in place
+    if (buft == ggml_backend_cpu_buffer_type()) {
+        n_allocated += whisper_model_repack_tensors(model);
+    }
+
+    // use the weights in place when the model file is memory mapped and the weights stay in CPU memory
+    if (mapping && buft == ggml_backend_cpu_buffer_type()) {
+        n_allocated += whisper_model_map_tensors(*mapping, model);
     }
 
-    size_t size_main = ggml_backend_buffer_get_size(model.buffer);
-    WHISPER_LOG_INFO("%s: %8s total size = %8.2f MB\n", __func__, ggml_backend_buffer_name(model.buffer), size_main / 1e6);
+    // allocate the remaining tensors in the backend buffers
+    if (n_allocated < (int) model.tensors.size()) {
+        model.buffer = ggml_backend_alloc_ctx_tensors_from_buft(model.ctx, buft);
+        if (!model.buffer) {
+            WHISPER_LOG_ERROR("%s: failed to allocate memory for the model\n", __func__);
+            return false;
+        }
+
+        size_t size_main = ggml_backend_buffer_get_size(model.buffer);
+        WHISPER_LOG_INFO("%s: %8s total size = %8.2f MB\n", __func__, ggml_backend_buffer_name(model.buffer), size_main / 1e6);
+    }
 
     // load weights
     {
@@ -1762,7 +2028,7 @@ static bool whisper_model_load(struct whisper_model_loader * loader, whisper_con
             std::string name;
             std::vector<char> tmp(length); // create a buffer
             loader->read(loader->context, &tmp[0], tmp.size()); // read to buffer
-            name.assign(&tmp[0], tmp.size());
+            name.assign(&tmp[0], strnlen(&tmp[0], tmp.size())); // names may be padded with zeros to align the data
 
             if (model.tensors.find(name) == model.tensors.end()) {
                 WHISPER_LOG_ERROR("%s: unknown tensor '%s' in model file\n", __func__, name.data());
@@ -1796,7 +2062,10 @@ static bool whisper_model_load(struct whisper_model_loader * loader, whisper_con
 
             //printf("%s: [%5.5s] %s\n", __func__, ggml_backend_name(backend), name.c_str());
 
-            if (ggml_backend_buffer_is_host(model.buffer)) {
+            if (model.buffer_mapped && tensor->buffer == model.buffer_mapped) {
+                // already in place in the mapped file
+                mapping->pos += ggml_nbytes(tensor);
+            } else if (ggml_backend_buffer_is_host(tensor->buffer)) {
                 // for the CPU and Metal backend, we can read directly into the tensor
                 loader->read(loader->context, tensor->data, ggml_nbytes(tensor));
                 BYTESWAP_TENSOR(tensor);
@@ -1824,7 +2093,17 @@ static bool whisper_model_load(struct whisper_model_loader * loader, whisper_con
         }
     }
 
-    ggml_backend_buffer_set_usage(model.buffer, GGML_BACKEND_BUFFER_USAGE_WEIGHTS);
+    if (model.buffer) {
+        ggml_backend_buffer_set_usage(model.buffer, GGML_BACKEND_BUFFER_USAGE_WEIGHTS);
+    }
+
+    if (model.buffer_mapped) {
+        ggml_backend_buffer_set_usage(model.buffer_mapped, GGML_BACKEND_BUFFER_USAGE_WEIGHTS);
+    }
+
+    if (model.buffer_repacked) {
+        ggml_backend_buffer_set_usage(model.buffer_repacked, GGML_BACKEND_BUFFER_USAGE_WEIGHTS);
+    }
 
     wctx.t_load_us = ggml_time_us() - t_start_us;
 
@@ -3491,12 +3770,52 @@ struct whisper_context_params whisper_context_default_params() {
             /*.heads            =*/ NULL,
         },
         /*.dtw_mem_size         =*/ 1024*1024*128,
+
+        /*.use_mmap             =*/ true,
+        /*.mmap_prefetch        =*/ false,
+
+        /*.threadpool           =*/ NULL,
+        /*.threadpool_lane      =*/ 0,
     };
     return result;
 }
 
 struct whisper_context * whisper_init_from_file_with_params_no_state(const char * path_model, struct whisper_context_params params) {
     WHISPER_LOG_INFO("%s: loading model from '%s'\n", __func__, path_model);
+
+    if (params.use_mmap) {
+        std::unique_ptr<whisper_mmap> mapping(new whisper_mmap);
+
+        if (mapping->open(path_model, params.mmap_prefetch)) {
+            whisper_model_loader loader = {};
+
+            loader.context = mapping.get();
+            loader.read    = whisper_mmap_read;
+
+            loader.eof = [](void * ctx) {
+                whisper_mmap * mm = (whisper_mmap *) ctx;
+                return mm->pos > mm->size;
+            };
+
+            loader.close = [](void * /*ctx*/) { };
+
+            auto ctx = whisper_init_with_params_no_state(&loader, params);
+
+            if (ctx) {
+                ctx->path_model = path_model;
+
+                // keep the mapping alive while tensors point into it
+                if (ctx->model.buffer_mapped) {
+                    ctx->model.mapping = std::move(mapping);
+                }
+            }
+
+            return ctx;
+        }
+
+        WHISPER_LOG_WARN("%s: failed to mmap '%s', reading it instead\n", __func__, path_model);
+    }
+
 #ifdef _MSC_VER
     // Convert UTF-8 path to wide string (UTF-16) for Windows, resolving character encoding issues.
     std::wstring_convert<std::codecvt_utf8<wchar_t>> converter;
@@ -3718,6 +4037,8 @@ void whisper_free(struct whisper_context * ctx) {
         ggml_free(ctx->model.ctx);
 
         ggml_backend_buffer_free(ctx->model.buffer);
+        ggml_backend_buffer_free(ctx->model.buffer_mapped);
+        ggml_backend_buffer_free(ctx->model.buffer_repacked);
 
         whisper_free_state(ctx->state);
 